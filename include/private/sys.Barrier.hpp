@@ -0,0 +1,164 @@
+/**
+ * @file      sys.Barrier.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_BARRIER_HPP_
+#define SYS_BARRIER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Futex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Barrier
+ * @brief Reusable barrier class of a number of parties.
+ *
+ * Parties wait on a phase futex word, and the last arrived party starts the next phase
+ * and wakes all the parties up by one futex broadcast.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class Barrier EOOS_SYS_FINAL : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param parties Number of parties.
+     */
+    explicit Barrier(int32_t parties);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Barrier();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Waits until all the parties arrive.
+     *
+     * @return True if all the parties have arrived.
+     */
+    bool_t wait();
+
+    /**
+     * @brief Returns number of parties.
+     *
+     * @return Number of parties.
+     */
+    int32_t getParties() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Number of parties.
+     */
+    int32_t parties_;
+
+    /**
+     * @brief Number of parties arrived in the current phase.
+     */
+    int32_t arrived_;
+
+    /**
+     * @brief Phase as futex word.
+     */
+    int32_t phase_;
+
+};
+
+template <class A>
+Barrier<A>::Barrier(int32_t const parties)
+    : NonCopyable<A>()
+    , parties_(parties)
+    , arrived_(0)
+    , phase_(0) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+Barrier<A>::~Barrier()
+{
+}
+
+template <class A>
+bool_t Barrier<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t Barrier<A>::wait()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        // The phase cannot change until this party arrives, so it is read before the arrival
+        int32_t const phase( __atomic_load_n(&phase_, __ATOMIC_ACQUIRE) );
+        int32_t const arrived( __atomic_add_fetch(&arrived_, 1, __ATOMIC_ACQ_REL) );
+        if( arrived == parties_ )
+        {
+            __atomic_store_n(&arrived_, 0, __ATOMIC_RELAXED);
+            static_cast<void>( __atomic_add_fetch(&phase_, 1, __ATOMIC_RELEASE) );
+            if( parties_ > 1 )
+            {
+                static_cast<void>( Futex::wake(&phase_, INT_MAX) );
+            }
+        }
+        else
+        {
+            while( __atomic_load_n(&phase_, __ATOMIC_ACQUIRE) == phase )
+            {
+                static_cast<void>( Futex::wait(&phase_, phase) );
+            }
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+int32_t Barrier<A>::getParties() const
+{
+    return parties_;
+}
+
+template <class A>
+bool_t Barrier<A>::construct()
+{
+    bool_t res( false );
+    if( isConstructed() && (parties_ > 0) )
+    {
+        res = true;
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_BARRIER_HPP_
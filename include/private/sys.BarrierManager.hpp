@@ -0,0 +1,147 @@
+/**
+ * @file      sys.BarrierManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_BARRIERMANAGER_HPP_
+#define SYS_BARRIERMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Barrier.hpp"
+#include "sys.Latch.hpp"
+#include "sys.ResourceMemory.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class BarrierManager.
+ * @brief Barrier and latch sub-system manager.
+ */
+class BarrierManager : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+    typedef Barrier<BarrierManager> BarrierResource;
+    typedef Latch<BarrierManager> LatchResource;
+    typedef ResourceSlot<BarrierResource, LatchResource> Slot;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    BarrierManager();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~BarrierManager();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Creates a new barrier resource.
+     *
+     * @param parties Number of parties.
+     * @return A new barrier resource, or NULLPTR if an error has been occurred.
+     */
+    Barrier<BarrierManager>* createBarrier(int32_t parties);
+
+    /**
+     * @brief Creates a new latch resource.
+     *
+     * @param count Initial counter value.
+     * @return A new latch resource, or NULLPTR if an error has been occurred.
+     */
+    Latch<BarrierManager>* createLatch(int32_t count);
+
+    /**
+     * @brief Returns statistics of the resource memory pool.
+     *
+     * @param statistics Statistics the pool statistics are copied to.
+     * @return True if the statistics are got.
+     */
+    bool_t getStatistics(ResourceStatistics& statistics) const;
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees allocated memory.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);        
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes the allocator with heap for resource allocation.
+     *
+     * @param resource Heap for resource allocation.
+     * @return True if initialized.
+     */
+    static bool_t initialize(api::Heap* resource);
+
+    /**
+     * @brief Initializes the allocator.
+     */
+    static void deinitialize();
+    
+    /**
+     * @struct ResourcePool
+     * @brief Resource memory pool.
+     */
+    struct ResourcePool
+    {
+
+    public:
+        
+        /**
+         * @brief Constructor.
+         */        
+        ResourcePool();
+
+        /**
+         * @brief Barrier and latch memory allocator.
+         */     
+        ResourceMemory<Slot, EOOS_GLOBAL_SYS_NUMBER_OF_BARRIERS> memory;
+
+    };
+
+    /**
+     * @brief Heap for resource allocation.
+     */
+    static api::Heap* resource_;
+        
+    /**
+     * @brief Resource memory pool.
+     */
+    ResourcePool pool_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_BARRIERMANAGER_HPP_
@@ -0,0 +1,218 @@
+/**
+ * @file      sys.Callable.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CALLABLE_HPP_
+#define SYS_CALLABLE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Task.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Callable
+ * @brief Task of a callable object which is stored inline.
+ *
+ * A function pointer or a function object with its captured state is copied into a buffer
+ * of the task, so the task allocates no memory. A callable object which does not fit
+ * the buffer is rejected at compile time.
+ */
+class Callable : public NonCopyable<NoAllocator>, public api::Task
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Size of the buffer of a callable object in bytes.
+     */
+    static const size_t CAPACITY = EOOS_GLOBAL_SYS_CALLABLE_CAPACITY;
+
+    /**
+     * @brief Constructor of not constructed object which has no callable object.
+     */
+    Callable();
+
+    /**
+     * @brief Constructor.
+     *
+     * @param function  A callable object which is called without arguments.
+     * @param stackSize Stack size of a thread the task is executed by, or zero for the default size.
+     * @tparam F Type of the callable object.
+     */
+    template <class F>
+    Callable(F const& function, size_t stackSize);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Callable();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Task::start()
+     */
+    virtual void start();
+
+    /**
+     * @copydoc eoos::api::Task::getStackSize()
+     */
+    virtual size_t getStackSize() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @struct Fits
+     * @brief Type which is complete only if a callable object fits the buffer.
+     *
+     * @tparam IS_FIT True if the callable object fits.
+     */
+    template <bool_t IS_FIT>
+    struct Fits;
+
+    /**
+     * @struct Holder
+     * @brief Holder of a callable object which is placed in the buffer.
+     *
+     * @tparam F Type of the callable object.
+     */
+    template <class F>
+    struct Holder
+    {
+        /**
+         * @brief Constructor.
+         *
+         * @param object A callable object which is copied.
+         */
+        explicit Holder(F const& object);
+
+        /**
+         * @brief Operator new for the holder placed in the buffer.
+         *
+         * @param size Number of bytes to allocate.
+         * @param ptr  Memory the holder is placed in.
+         * @return The memory.
+         */
+        static void* operator new(size_t size, void* ptr);
+
+        /**
+         * @brief Operator delete for the holder placed in the buffer.
+         *
+         * @param ptr   Address of the holder.
+         * @param place Memory the holder is placed in.
+         */
+        static void operator delete(void* ptr, void* place);
+
+        /**
+         * @brief The callable object.
+         */
+        F function; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+    };
+
+    /**
+     * @brief Calls a callable object.
+     *
+     * @param function Address of the callable object.
+     * @tparam F Type of the callable object.
+     */
+    template <class F>
+    static void invoke(void* function);
+
+    /**
+     * @brief Destroys a callable object.
+     *
+     * @param function Address of the callable object.
+     * @tparam F Type of the callable object.
+     */
+    template <class F>
+    static void destroy(void* function);
+
+    /**
+     * @brief Buffer of the callable object.
+     */
+    uint64_t buffer_[ (CAPACITY + sizeof(uint64_t) - 1U) / sizeof(uint64_t) ] __attribute__((aligned(__BIGGEST_ALIGNMENT__)));
+
+    /**
+     * @brief Function calling the callable object.
+     */
+    void (*invoke_)(void*);
+
+    /**
+     * @brief Function destroying the callable object.
+     */
+    void (*destroy_)(void*);
+
+    /**
+     * @brief Stack size of a thread.
+     */
+    size_t stackSize_;
+
+};
+
+/**
+ * @struct Callable::Fits<true>
+ * @brief Complete type of a callable object which fits the buffer.
+ */
+template <>
+struct Callable::Fits<true>
+{
+};
+
+template <class F>
+Callable::Callable(F const& function, size_t const stackSize)
+    : NonCopyable<NoAllocator>()
+    , api::Task()
+    , buffer_()
+    , invoke_(&invoke<F>)
+    , destroy_(&destroy<F>)
+    , stackSize_(stackSize) {
+    // The expression does not compile if the callable object does not fit the buffer
+    static_cast<void>( sizeof( Fits< (sizeof(Holder<F>) <= sizeof(buffer_)) && (__alignof__(Holder<F>) <= __BIGGEST_ALIGNMENT__) > ) );
+    static_cast<void>( new (buffer_) Holder<F>(function) );
+}
+
+template <class F>
+void Callable::invoke(void* const function)
+{
+    (static_cast<Holder<F>*>(function)->function)();
+}
+
+template <class F>
+void Callable::destroy(void* const function)
+{
+    static_cast<Holder<F>*>(function)->~Holder();
+}
+
+template <class F>
+Callable::Holder<F>::Holder(F const& object)
+    : function(object) {
+}
+
+template <class F>
+void* Callable::Holder<F>::operator new(size_t, void* const ptr)
+{
+    return ptr;
+}
+
+template <class F>
+void Callable::Holder<F>::operator delete(void*, void*)
+{
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CALLABLE_HPP_
@@ -0,0 +1,103 @@
+/**
+ * @file      sys.CancellationToken.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CANCELLATIONTOKEN_HPP_
+#define SYS_CANCELLATIONTOKEN_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.NoAllocator.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class CancellationToken
+ * @brief Token of a cooperative cancellation request.
+ *
+ * A task polls the token or waits on it, and stops itself when the cancellation is requested.
+ * The token is a futex word, so a task waiting on it is woken up at once by the request.
+ */
+class CancellationToken : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    CancellationToken();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CancellationToken();
+
+    /**
+     * @brief Requests the cancellation.
+     */
+    void cancel();
+
+    /**
+     * @brief Tests if the cancellation has been requested.
+     *
+     * @return True if the cancellation has been requested.
+     */
+    bool_t isCancelled() const;
+
+    /**
+     * @brief Waits for the cancellation request.
+     */
+    void wait();
+
+    /**
+     * @brief Waits for the cancellation request for a time.
+     *
+     * @param ms A time to wait in milliseconds.
+     * @return True if the cancellation has been requested, false if timed out.
+     */
+    bool_t wait(int32_t ms);
+
+    /**
+     * @brief Waits for the cancellation request until a deadline.
+     *
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock.
+     * @return True if the cancellation has been requested, false if timed out.
+     */
+    bool_t waitUntil(::timespec const& deadline);
+
+    /**
+     * @brief Returns the token of the caller thread.
+     *
+     * @return The token of the caller thread, or NULLPTR if the thread has no token.
+     */
+    static CancellationToken* getCurrent();
+
+    /**
+     * @brief Sets the token of the caller thread.
+     *
+     * @param token A token, or NULLPTR.
+     */
+    static void setCurrent(CancellationToken* token);
+
+private:
+
+    /**
+     * @brief Cancellation flag as futex word.
+     */
+    int32_t isCancelled_;
+
+    /**
+     * @brief The token of the caller thread.
+     */
+    static __thread CancellationToken* current_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CANCELLATIONTOKEN_HPP_
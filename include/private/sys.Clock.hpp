@@ -0,0 +1,55 @@
+/**
+ * @file      sys.Clock.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CLOCK_HPP_
+#define SYS_CLOCK_HPP_
+
+#include "sys.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Clock
+ * @brief Monotonic clock of timeouts.
+ */
+class Clock
+{
+
+public:
+
+    /**
+     * @brief Gets a deadline.
+     *
+     * @param ms       A time in milliseconds from now.
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock.
+     * @return True if the deadline is got.
+     */
+    static bool_t getDeadline(int32_t ms, ::timespec& deadline);
+
+    /**
+     * @brief Gets a deadline.
+     *
+     * @param timeout  Relative time from now.
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock.
+     * @return True if the deadline is got.
+     */
+    static bool_t getDeadline(::timespec const& timeout, ::timespec& deadline);
+
+    /**
+     * @brief Tests if a deadline has passed.
+     *
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock.
+     * @return True if the deadline has passed or the clock is not available.
+     */
+    static bool_t isExpired(::timespec const& deadline);
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CLOCK_HPP_
@@ -0,0 +1,271 @@
+/**
+ * @file      sys.ConditionVariable.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CONDITIONVARIABLE_HPP_
+#define SYS_CONDITIONVARIABLE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Mutex.hpp"
+#include "sys.Futex.hpp"
+#include "sys.Clock.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ConditionVariable
+ * @brief Condition variable class.
+ *
+ * The notification to all waiters moves them to a gate futex word instead of waking them up,
+ * and each waiter passes the gate to the next one after it has locked the mutex again.
+ * Thus, only one notified waiter contends for the mutex at a time.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class ConditionVariable : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ConditionVariable();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ConditionVariable();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Waits for a notification.
+     *
+     * @param mutex A mutex locked by the caller, which is unlocked while waiting.
+     * @return True if the waiting has been woken up.
+     */
+    bool_t wait(api::Mutex& mutex);
+
+    /**
+     * @brief Waits for a notification for a time.
+     *
+     * @param mutex A mutex locked by the caller, which is unlocked while waiting.
+     * @param ms    A time to wait in milliseconds.
+     * @return True if the waiting has been woken up, false if timed out.
+     */
+    bool_t wait(api::Mutex& mutex, int32_t ms);
+
+    /**
+     * @brief Notifies one waiter.
+     *
+     * @return True if notified.
+     */
+    bool_t notifyOne();
+
+    /**
+     * @brief Notifies all waiters.
+     *
+     * @return True if notified.
+     */
+    bool_t notifyAll();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Waits for a notification until a deadline.
+     *
+     * @param mutex    A mutex locked by the caller, which is unlocked while waiting.
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock, or a null pointer to wait infinitely.
+     * @return True if the waiting has been woken up.
+     */
+    bool_t waitUntil(api::Mutex& mutex, ::timespec const* deadline);
+
+    /**
+     * @brief Passes the gate to next notified waiter.
+     */
+    void pass();
+
+    /**
+     * @brief Notification sequence as futex word.
+     */
+    int32_t sequence_;
+
+    /**
+     * @brief Number of waiters.
+     */
+    int32_t waiters_;
+
+    /**
+     * @brief Gate futex word of notified waiters.
+     */
+    int32_t gate_;
+
+    /**
+     * @brief Number of notified waiters moved to the gate.
+     */
+    int32_t gated_;
+
+};
+
+template <class A>
+ConditionVariable<A>::ConditionVariable()
+    : NonCopyable<A>()
+    , sequence_(0)
+    , waiters_(0)
+    , gate_(0)
+    , gated_(0) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+ConditionVariable<A>::~ConditionVariable()
+{
+}
+
+template <class A>
+bool_t ConditionVariable<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t ConditionVariable<A>::wait(api::Mutex& mutex)
+{
+    return waitUntil(mutex, NULLPTR);
+}
+
+template <class A>
+bool_t ConditionVariable<A>::wait(api::Mutex& mutex, int32_t const ms)
+{
+    bool_t res( false );
+    ::timespec deadline;
+    if( Clock::getDeadline(ms, deadline) )
+    {
+        res = waitUntil(mutex, &deadline);
+    }
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariable<A>::notifyOne()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        static_cast<void>( __atomic_add_fetch(&sequence_, 1, __ATOMIC_SEQ_CST) );
+        if( __atomic_load_n(&waiters_, __ATOMIC_SEQ_CST) > 0 )
+        {
+            static_cast<void>( Futex::wake(&sequence_, 1) );
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariable<A>::notifyAll()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        int32_t const sequence( __atomic_add_fetch(&sequence_, 1, __ATOMIC_SEQ_CST) );
+        if( __atomic_load_n(&waiters_, __ATOMIC_SEQ_CST) > 0 )
+        {
+            int32_t const number( Futex::requeue(&sequence_, sequence, 0, &gate_) );
+            if( number > 0 )
+            {
+                static_cast<void>( __atomic_add_fetch(&gated_, number, __ATOMIC_SEQ_CST) );
+                pass();
+            }
+            else if( number < 0 )
+            {
+                // The sequence has been changed by other notification
+                static_cast<void>( Futex::wake(&sequence_, INT_MAX) );
+            }
+            else
+            {
+                // The waiters are not on the futex word yet, but they see the new sequence
+            }
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariable<A>::construct()
+{
+    return isConstructed();
+}
+
+template <class A>
+bool_t ConditionVariable<A>::waitUntil(api::Mutex& mutex, ::timespec const* const deadline)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        int32_t const sequence( __atomic_load_n(&sequence_, __ATOMIC_SEQ_CST) );
+        static_cast<void>( __atomic_add_fetch(&waiters_, 1, __ATOMIC_SEQ_CST) );
+        if( mutex.unlock() )
+        {
+            bool_t isWoken( false );
+            if( deadline == NULLPTR )
+            {
+                isWoken = Futex::wait(&sequence_, sequence);
+            }
+            else
+            {
+                isWoken = Futex::wait(&sequence_, sequence, *deadline);
+            }
+            static_cast<void>( __atomic_sub_fetch(&waiters_, 1, __ATOMIC_SEQ_CST) );
+            bool_t const isLocked( mutex.lock() );
+            pass();
+            res = isWoken && isLocked;
+        }
+        else
+        {
+            static_cast<void>( __atomic_sub_fetch(&waiters_, 1, __ATOMIC_SEQ_CST) );
+        }
+    }
+    return res;
+}
+
+template <class A>
+void ConditionVariable<A>::pass()
+{
+    int32_t gated( __atomic_load_n(&gated_, __ATOMIC_SEQ_CST) );
+    while( gated > 0 )
+    {
+        if( __atomic_compare_exchange_n(&gated_, &gated, gated - 1, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) )
+        {
+            static_cast<void>( Futex::wake(&gate_, 1) );
+            break;
+        }
+    }
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CONDITIONVARIABLE_HPP_
@@ -19,6 +19,8 @@
  *  - If EOOS_GLOBAL_SYS_NUMBER_OF_<resource_name> equals zero and EOOS_GLOBAL_ENABLE_NO_HEAP is defined, 
  *    the resource will NOT be allocated.
  *  - EOOS_GLOBAL_SYS_NUMBER_OF_<resource_name> less then zero is prohibbited.
+ *  - If the pool memory is exhausted, the resource will be allocated in a memory region which number of resources
+ *    is set at startup by EOOS_SYS_NUMBER_OF_<resource_name> environment variable, and then in heap memory.
  * 
  * @note 
  *  To comply MISRA-C++:2008 in Rule 18–4–1:
@@ -44,6 +46,105 @@
     #define EOOS_GLOBAL_SYS_NUMBER_OF_THREADS (0)
 #endif
 
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_CONDITION_VARIABLES
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_CONDITION_VARIABLES (0)
+#endif
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_SPINLOCKS
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_SPINLOCKS (0)
+#endif
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_BARRIERS
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_BARRIERS (0)
+#endif
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_EVENT_FLAGS
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_EVENT_FLAGS (0)
+#endif
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_QUEUES
+    #define EOOS_GLOBAL_SYS_NUMBER_OF_QUEUES (0)
+#endif
+
+/**
+ * @brief Maximum number of elements of queues created by the queue manager.
+ *
+ * @note The definition may be passed to the project build system through global compile definitions.
+ *       The value shall be a power of two.
+ */
+#ifndef EOOS_GLOBAL_SYS_QUEUE_LENGTH
+    #define EOOS_GLOBAL_SYS_QUEUE_LENGTH (64)
+#endif
+
+/**
+ * @brief Size in bytes of a callable object with its captured state which a thread can be created with.
+ *
+ * @note The definition may be passed to the project build system through global compile definitions.
+ */
+#ifndef EOOS_GLOBAL_SYS_CALLABLE_CAPACITY
+    #define EOOS_GLOBAL_SYS_CALLABLE_CAPACITY (64)
+#endif
+
+/**
+ * @brief Time in milliseconds a process waits for other process to initialize named shared memory.
+ *
+ * @note The definition may be passed to the project build system through global compile definitions.
+ */
+#ifndef EOOS_GLOBAL_SYS_SHARED_MEMORY_TIMEOUT
+    #define EOOS_GLOBAL_SYS_SHARED_MEMORY_TIMEOUT (1000)
+#endif
+
+/**
+ * @brief Time in milliseconds threads are given to return on a cancellation request
+ *        when they are destroyed or the system is shut down.
+ *
+ * @note Deleting a running thread blocks the caller for up to this time, even for a thread which never
+ *       polls its cancellation token. A thread which has not returned in time is detached and still executed,
+ *       and its memory is freed on return. Zero gives threads no time, so deleting does not block.
+ *
+ * @note The system shut down does not wait longer for threads which have not returned in time. It reports them
+ *       to the error stream and leaves them detached, and they do not access the system resources on return.
+ *       The static slots of EOOS_GLOBAL_SYS_NUMBER_OF_THREADS are destroyed with the system though,
+ *       so threads shall return in time if the static slots are configured.
+ *
+ * @note The definition may be passed to the project build system through global compile definitions.
+ */
+#ifndef EOOS_GLOBAL_SYS_THREAD_STOP_TIMEOUT
+    #define EOOS_GLOBAL_SYS_THREAD_STOP_TIMEOUT (1000)
+#endif
+
+/**
+ * @brief Size of CPU data cache line in bytes.
+ *
+ * @note The definition may be passed to the project build system through global compile definitions.
+ */
+#ifndef EOOS_GLOBAL_SYS_CACHE_LINE_SIZE
+    #define EOOS_GLOBAL_SYS_CACHE_LINE_SIZE (64)
+#endif
+
+/**
+ * @brief Pads and aligns each resource of the resource pools to the cache line size,
+ *        so pooled resources used by different CPUs do not share a cache line.
+ *
+ * @note The definition shall be passed to the project build system through global compile definitions.
+ * #define EOOS_GLOBAL_SYS_RESOURCE_PADDING
+ */
+
+/**
+ * @brief Sets MCS queue lock as the mutex backend of the mutex manager.
+ *
+ * @note The definition shall be passed to the project build system through global compile definitions.
+ * #define EOOS_GLOBAL_SYS_MUTEX_MCS
+ */
+
+/**
+ * @brief Removes checks if mutexes and semaphores are constructed from their lock and acquire paths.
+ *
+ * @note The definition shall be passed to the project build system through global compile definitions.
+ *       Then, a caller shall not use a resource which has not been constructed.
+ * #define EOOS_GLOBAL_SYS_NO_CONSTRUCTED_CHECKS
+ */
+
 /**
  * @brief Sets child thread's CPU affinity mask to primary thread CPU..
  *
@@ -0,0 +1,332 @@
+/**
+ * @file      sys.EventFlags.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EVENTFLAGS_HPP_
+#define SYS_EVENTFLAGS_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Futex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class EventFlags
+ * @brief Event flags class to wait for any or all of a number of events.
+ *
+ * The flags are kept in one futex word, so a waiter blocks once whatever number of events it waits for.
+ * Waiters are counted, and setting flags makes a system call only if there is a blocked waiter.
+ *
+ * @note The flags are 32 bits as a futex word is.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class EventFlags EOOS_SYS_FINAL : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @enum Option
+     * @brief Wait options which are combined by bitwise OR.
+     */
+    enum Option
+    {
+        OPTION_ANY   = 0x0, ///< Waits for any flag of a mask.
+        OPTION_ALL   = 0x1, ///< Waits for all flags of a mask.
+        OPTION_CLEAR = 0x2  ///< Clears the flags of a mask the wait has been satisfied with.
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param flags The initial flags.
+     */
+    explicit EventFlags(uint32_t flags);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~EventFlags();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Sets flags.
+     *
+     * @param mask Flags to be set.
+     * @return True if the flags have been set.
+     */
+    bool_t set(uint32_t mask);
+
+    /**
+     * @brief Clears flags.
+     *
+     * @param mask Flags to be cleared.
+     * @return True if the flags have been cleared.
+     */
+    bool_t clear(uint32_t mask);
+
+    /**
+     * @brief Returns the flags.
+     *
+     * @return The flags.
+     */
+    uint32_t get() const;
+
+    /**
+     * @brief Waits for flags.
+     *
+     * @param mask    Flags to wait for.
+     * @param options Wait options.
+     * @return The flags which have satisfied the wait before they are cleared, or zero if an error occurred.
+     */
+    uint32_t wait(uint32_t mask, int32_t options);
+
+    /**
+     * @brief Waits for flags until a deadline.
+     *
+     * @param mask     Flags to wait for.
+     * @param options  Wait options.
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock.
+     * @return The flags which have satisfied the wait before they are cleared, or zero if timed out or an error occurred.
+     */
+    uint32_t waitUntil(uint32_t mask, int32_t options, ::timespec const& deadline);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Blocks the caller until flags satisfy a wait.
+     *
+     * @param mask     Flags to wait for.
+     * @param options  Wait options.
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock, or NULLPTR to wait infinitely.
+     * @return The flags which have satisfied the wait, or zero if timed out.
+     */
+    uint32_t block(uint32_t mask, int32_t options, ::timespec const* deadline);
+
+    /**
+     * @brief Takes flags if they satisfy a wait.
+     *
+     * @param mask    Flags to wait for.
+     * @param options Wait options.
+     * @return The flags which have satisfied the wait, or zero if they do not.
+     */
+    uint32_t take(uint32_t mask, int32_t options);
+
+    /**
+     * @brief Tests if flags satisfy a wait.
+     *
+     * @param flags   Flags.
+     * @param mask    Flags to wait for.
+     * @param options Wait options.
+     * @return True if the flags satisfy the wait.
+     */
+    static bool_t isSatisfied(uint32_t flags, uint32_t mask, int32_t options);
+
+    /**
+     * @brief Flags as futex word.
+     */
+    int32_t flags_;
+
+    /**
+     * @brief Number of blocked waiters.
+     */
+    int32_t waiters_;
+
+};
+
+template <class A>
+EventFlags<A>::EventFlags(uint32_t const flags)
+    : NonCopyable<A>()
+    , flags_( static_cast<int32_t>(flags) )
+    , waiters_(0) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+EventFlags<A>::~EventFlags()
+{
+}
+
+template <class A>
+bool_t EventFlags<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t EventFlags<A>::set(uint32_t const mask)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        int32_t const flags( __atomic_fetch_or(&flags_, static_cast<int32_t>(mask), __ATOMIC_SEQ_CST) );
+        bool_t const isChanged( (static_cast<uint32_t>(flags) | mask) != static_cast<uint32_t>(flags) );
+        if( isChanged && (__atomic_load_n(&waiters_, __ATOMIC_SEQ_CST) > 0) )
+        {
+            // Waiters wait for different flags, so all of them are woken up to test the flags
+            static_cast<void>( Futex::wake(&flags_, INT_MAX) );
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t EventFlags<A>::clear(uint32_t const mask)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        static_cast<void>( __atomic_fetch_and(&flags_, static_cast<int32_t>(~mask), __ATOMIC_SEQ_CST) );
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+uint32_t EventFlags<A>::get() const
+{
+    uint32_t flags( 0U );
+    if( isConstructed() )
+    {
+        flags = static_cast<uint32_t>( __atomic_load_n(&flags_, __ATOMIC_ACQUIRE) );
+    }
+    return flags;
+}
+
+template <class A>
+uint32_t EventFlags<A>::wait(uint32_t const mask, int32_t const options)
+{
+    uint32_t flags( 0U );
+    if( isConstructed() && (mask != 0U) )
+    {
+        flags = block(mask, options, NULLPTR);
+    }
+    return flags;
+}
+
+template <class A>
+uint32_t EventFlags<A>::waitUntil(uint32_t const mask, int32_t const options, ::timespec const& deadline)
+{
+    uint32_t flags( 0U );
+    if( isConstructed() && (mask != 0U) )
+    {
+        flags = block(mask, options, &deadline);
+    }
+    return flags;
+}
+
+template <class A>
+bool_t EventFlags<A>::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+uint32_t EventFlags<A>::block(uint32_t const mask, int32_t const options, ::timespec const* const deadline)
+{
+    uint32_t flags( take(mask, options) );
+    if( flags == 0U )
+    {
+        static_cast<void>( __atomic_add_fetch(&waiters_, 1, __ATOMIC_SEQ_CST) );
+        while( true )
+        {
+            flags = take(mask, options);
+            if( flags != 0U )
+            {
+                break;
+            }
+            // The flags are read after the waiters counter is incremented, so a setter either sees
+            // the waiter or changes the flags before the futex word is compared with them
+            int32_t const value( __atomic_load_n(&flags_, __ATOMIC_SEQ_CST) );
+            if( isSatisfied(static_cast<uint32_t>(value), mask, options) )
+            {
+                continue;
+            }
+            if( deadline == NULLPTR )
+            {
+                static_cast<void>( Futex::wait(&flags_, value) );
+            }
+            else if( !Futex::wait(&flags_, value, *deadline) )
+            {
+                flags = take(mask, options);
+                break;
+            }
+            else
+            {
+                // Woken up to test the flags again
+            }
+        }
+        static_cast<void>( __atomic_sub_fetch(&waiters_, 1, __ATOMIC_RELAXED) );
+    }
+    return flags;
+}
+
+template <class A>
+uint32_t EventFlags<A>::take(uint32_t const mask, int32_t const options)
+{
+    uint32_t res( 0U );
+    int32_t flags( __atomic_load_n(&flags_, __ATOMIC_ACQUIRE) );
+    while( isSatisfied(static_cast<uint32_t>(flags), mask, options) )
+    {
+        if( (options & OPTION_CLEAR) == 0 )
+        {
+            res = static_cast<uint32_t>(flags);
+            break;
+        }
+        int32_t const next( static_cast<int32_t>( static_cast<uint32_t>(flags) & ~mask ) );
+        if( __atomic_compare_exchange_n(&flags_, &flags, next, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) )
+        {
+            res = static_cast<uint32_t>(flags);
+            break;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t EventFlags<A>::isSatisfied(uint32_t const flags, uint32_t const mask, int32_t const options)
+{
+    bool_t res( false );
+    if( (options & OPTION_ALL) != 0 )
+    {
+        res = (flags & mask) == mask;
+    }
+    else
+    {
+        res = (flags & mask) != 0U;
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EVENTFLAGS_HPP_
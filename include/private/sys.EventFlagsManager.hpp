@@ -0,0 +1,136 @@
+/**
+ * @file      sys.EventFlagsManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EVENTFLAGSMANAGER_HPP_
+#define SYS_EVENTFLAGSMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.EventFlags.hpp"
+#include "sys.ResourceMemory.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class EventFlagsManager.
+ * @brief Event flags sub-system manager.
+ */
+class EventFlagsManager : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+    typedef EventFlags<EventFlagsManager> Resource;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    EventFlagsManager();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~EventFlagsManager();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Creates a new event flags resource.
+     *
+     * @param flags The initial flags.
+     * @return A new event flags resource, or NULLPTR if an error has been occurred.
+     */
+    EventFlags<EventFlagsManager>* create(uint32_t flags);
+
+    /**
+     * @brief Returns statistics of the resource memory pool.
+     *
+     * @param statistics Statistics the pool statistics are copied to.
+     * @return True if the statistics are got.
+     */
+    bool_t getStatistics(ResourceStatistics& statistics) const;
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees allocated memory.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);        
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes the allocator with heap for resource allocation.
+     *
+     * @param resource Heap for resource allocation.
+     * @return True if initialized.
+     */
+    static bool_t initialize(api::Heap* resource);
+
+    /**
+     * @brief Initializes the allocator.
+     */
+    static void deinitialize();
+    
+    /**
+     * @struct ResourcePool
+     * @brief Resource memory pool.
+     */
+    struct ResourcePool
+    {
+
+    public:
+        
+        /**
+         * @brief Constructor.
+         */        
+        ResourcePool();
+
+        /**
+         * @brief Event flags memory allocator.
+         */     
+        ResourceMemory<Resource, EOOS_GLOBAL_SYS_NUMBER_OF_EVENT_FLAGS> memory;
+
+    };
+
+    /**
+     * @brief Heap for resource allocation.
+     */
+    static api::Heap* resource_;
+        
+    /**
+     * @brief Resource memory pool.
+     */
+    ResourcePool pool_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EVENTFLAGSMANAGER_HPP_
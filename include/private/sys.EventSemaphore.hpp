@@ -0,0 +1,240 @@
+/**
+ * @file      sys.EventSemaphore.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EVENTSEMAPHORE_HPP_
+#define SYS_EVENTSEMAPHORE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Semaphore.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class EventSemaphore
+ * @brief Semaphore class on an event file descriptor.
+ *
+ * Permits are counted by a non-blocking eventfd in semaphore mode. The descriptor is readable
+ * while permits are available, so it can be waited on by poll or epoll together with other
+ * file descriptors, and a permit is then taken by tryAcquire().
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class EventSemaphore EOOS_SYS_FINAL : public NonCopyable<A>, public api::Semaphore
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param permits The initial number of permits available.
+     */
+    explicit EventSemaphore(int32_t permits);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~EventSemaphore();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Semaphore::acquire()
+     */
+    virtual bool_t acquire();
+
+    /**
+     * @copydoc eoos::api::Semaphore::release()
+     */
+    virtual bool_t release();
+
+    /**
+     * @brief Releases a number of permits at once.
+     *
+     * @param count Number of permits.
+     * @return True if the permits have been released.
+     */
+    bool_t release(int32_t count);
+
+    /**
+     * @brief Acquires one permit if it is available.
+     *
+     * @return True if the permit has been acquired.
+     */
+    bool_t tryAcquire();
+
+    /**
+     * @brief Returns the event file descriptor.
+     *
+     * @note The descriptor is owned by the semaphore and shall not be read, written or closed by a caller.
+     *
+     * @return The file descriptor, which is readable while permits are available.
+     */
+    int_t getDescriptor() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Deinitializes the event file descriptor.
+     */
+    void deinitialize();
+
+    /**
+     * @brief Number of permits available.
+     */
+    int32_t permits_;
+
+    /**
+     * @brief Event file descriptor.
+     */
+    int_t fd_;
+
+};
+
+template <class A>
+EventSemaphore<A>::EventSemaphore(int32_t const permits)
+    : NonCopyable<A>()
+    , api::Semaphore()
+    , permits_(permits)
+    , fd_(-1) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+EventSemaphore<A>::~EventSemaphore()
+{
+    deinitialize();
+}
+
+template <class A>
+bool_t EventSemaphore<A>::isConstructed() const ///< SCA MISRA-C++:2008 Justified Rule 10-3-1
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t EventSemaphore<A>::acquire()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        while( !res )
+        {
+            res = tryAcquire();
+            if( !res )
+            {
+                if( errno != EAGAIN )
+                {
+                    break;
+                }
+                ::pollfd fds = { fd_, POLLIN, 0 };
+                int_t const number( ::poll(&fds, 1U, -1) );
+                if( (number < 0) && (errno != EINTR) )
+                {
+                    break;
+                }
+            }
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t EventSemaphore<A>::release()
+{
+    return release(1);
+}
+
+template <class A>
+bool_t EventSemaphore<A>::release(int32_t const count)
+{
+    bool_t res( false );
+    if( Parent::isUsable() && (count > 0) )
+    {
+        ::eventfd_t const value( static_cast< ::eventfd_t >(count) );
+        int_t const error( ::eventfd_write(fd_, value) );
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t EventSemaphore<A>::tryAcquire()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        ::eventfd_t value( 0U );
+        int_t error( 0 );
+        do
+        {
+            error = ::eventfd_read(fd_, &value);
+        }
+        while( (error != 0) && (errno == EINTR) );
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+int_t EventSemaphore<A>::getDescriptor() const
+{
+    return fd_;
+}
+
+template <class A>
+bool_t EventSemaphore<A>::construct()
+{
+    bool_t res( false );
+    if( isConstructed() && (permits_ >= 0) )
+    {
+        fd_ = ::eventfd(static_cast<uint_t>(permits_), EFD_SEMAPHORE | EFD_NONBLOCK | EFD_CLOEXEC);
+        if( fd_ >= 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+void EventSemaphore<A>::deinitialize()
+{
+    if( fd_ >= 0 )
+    {
+        static_cast<void>( ::close(fd_) );
+        fd_ = -1;
+    }
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EVENTSEMAPHORE_HPP_
@@ -0,0 +1,367 @@
+/**
+ * @file      sys.FairSemaphore.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_FAIRSEMAPHORE_HPP_
+#define SYS_FAIRSEMAPHORE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Semaphore.hpp"
+#include "sys.Futex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class FairSemaphore
+ * @brief Semaphore class which grants permits in FIFO order.
+ *
+ * Blocked acquirers are queued on nodes placed on their stacks. A release hands off the permits
+ * directly to the queued acquirers from the head of the queue, and a new acquirer never takes
+ * permits while the queue is not empty. Thus, the permits are granted in order of the acquisition
+ * whatever the scheduling policy is.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class FairSemaphore EOOS_SYS_FINAL : public NonCopyable<A>, public api::Semaphore
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param permits The initial number of permits available.
+     */
+    explicit FairSemaphore(int32_t permits);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~FairSemaphore();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Semaphore::acquire()
+     */
+    virtual bool_t acquire();
+
+    /**
+     * @copydoc eoos::api::Semaphore::release()
+     */
+    virtual bool_t release();
+
+    /**
+     * @brief Acquires a number of permits at once.
+     *
+     * @param count Number of permits.
+     * @return True if the permits have been acquired.
+     */
+    bool_t acquire(int32_t count);
+
+    /**
+     * @brief Releases a number of permits at once.
+     *
+     * @param count Number of permits.
+     * @return True if the permits have been released.
+     */
+    bool_t release(int32_t count);
+
+    /**
+     * @brief Acquires one permit if it is available and no acquirers are queued.
+     *
+     * @return True if the permit has been acquired.
+     */
+    bool_t tryAcquire();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @struct Node
+     * @brief Queue node of a blocked acquirer.
+     */
+    struct Node
+    {
+        /**
+         * @brief Constructor.
+         *
+         * @param number Number of permits to acquire.
+         */
+        explicit Node(int32_t number);
+
+        /**
+         * @brief Next acquirer node.
+         */
+        Node* next; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Number of permits to acquire.
+         */
+        int32_t count; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Grant flag as futex word which is non-zero if the permits are handed off.
+         */
+        int32_t granted; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes the queue mutex.
+     *
+     * @return True if initialized sucessfully.
+     */
+    bool_t initialize();
+
+    /**
+     * @brief Deinitializes the queue mutex.
+     */
+    void deinitialize();
+
+    /**
+     * @brief Waits until the permits are handed off to a node.
+     *
+     * @param node An acquirer node.
+     */
+    static void wait(Node& node);
+
+    /**
+     * @brief Hands off the permits to nodes.
+     *
+     * @param node The first node of a list of acquirer nodes.
+     */
+    static void grant(Node* node);
+
+    /**
+     * @brief Number of permits available.
+     */
+    int32_t permits_;
+
+    /**
+     * @brief First queued acquirer.
+     */
+    Node* head_;
+
+    /**
+     * @brief Last queued acquirer.
+     */
+    Node* tail_;
+
+    /**
+     * @brief Mutex of the permits and the queue.
+     */
+    ::pthread_mutex_t mutex_;
+
+};
+
+template <class A>
+FairSemaphore<A>::FairSemaphore(int32_t const permits)
+    : NonCopyable<A>()
+    , api::Semaphore()
+    , permits_(permits)
+    , head_(NULLPTR)
+    , tail_(NULLPTR)
+    , mutex_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+FairSemaphore<A>::~FairSemaphore()
+{
+    deinitialize();
+}
+
+template <class A>
+bool_t FairSemaphore<A>::isConstructed() const ///< SCA MISRA-C++:2008 Justified Rule 10-3-1
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t FairSemaphore<A>::acquire()
+{
+    return acquire(1);
+}
+
+template <class A>
+bool_t FairSemaphore<A>::release()
+{
+    return release(1);
+}
+
+template <class A>
+bool_t FairSemaphore<A>::acquire(int32_t const count)
+{
+    bool_t res( false );
+    if( Parent::isUsable() && (count > 0) )
+    {
+        Node node(count);
+        bool_t isQueued( false );
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            if( (head_ == NULLPTR) && (permits_ >= count) )
+            {
+                permits_ -= count;
+            }
+            else
+            {
+                if( tail_ == NULLPTR )
+                {
+                    head_ = &node;
+                }
+                else
+                {
+                    tail_->next = &node;
+                }
+                tail_ = &node;
+                isQueued = true;
+            }
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+            if( isQueued )
+            {
+                wait(node);
+            }
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t FairSemaphore<A>::release(int32_t const count)
+{
+    bool_t res( false );
+    if( Parent::isUsable() && (count > 0) )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            Node* granted( NULLPTR );
+            if( permits_ <= (INT_MAX - count) )
+            {
+                permits_ += count;
+                granted = head_;
+                Node* last( NULLPTR );
+                while( (head_ != NULLPTR) && (permits_ >= head_->count) )
+                {
+                    permits_ -= head_->count;
+                    last = head_;
+                    head_ = head_->next;
+                }
+                if( last == NULLPTR )
+                {
+                    granted = NULLPTR;
+                }
+                else
+                {
+                    last->next = NULLPTR;
+                }
+                if( head_ == NULLPTR )
+                {
+                    tail_ = NULLPTR;
+                }
+                res = true;
+            }
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+            grant(granted);
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t FairSemaphore<A>::tryAcquire()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            if( (head_ == NULLPTR) && (permits_ > 0) )
+            {
+                --permits_;
+                res = true;
+            }
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t FairSemaphore<A>::construct()
+{
+    bool_t res( false );
+    if( isConstructed() && (permits_ >= 0) )
+    {
+        res = initialize();
+    }
+    return res;
+}
+
+template <class A>
+bool_t FairSemaphore<A>::initialize()
+{
+    int_t const error( ::pthread_mutex_init(&mutex_, NULLPTR) );
+    return error == 0;
+}
+
+template <class A>
+void FairSemaphore<A>::deinitialize()
+{
+    static_cast<void>( ::pthread_mutex_destroy(&mutex_) );
+}
+
+template <class A>
+void FairSemaphore<A>::wait(Node& node)
+{
+    while( __atomic_load_n(&node.granted, __ATOMIC_ACQUIRE) == 0 )
+    {
+        static_cast<void>( Futex::wait(&node.granted, 0) );
+    }
+}
+
+template <class A>
+void FairSemaphore<A>::grant(Node* node)
+{
+    while( node != NULLPTR )
+    {
+        // The node is out of the queue, and its next field is read before the node might leave
+        // the acquirer stack frame. A spurious wake-up of the futex word is legal for any futex user.
+        Node* const next( node->next );
+        __atomic_store_n(&node->granted, 1, __ATOMIC_RELEASE);
+        static_cast<void>( Futex::wake(&node->granted, 1) );
+        node = next;
+    }
+}
+
+template <class A>
+FairSemaphore<A>::Node::Node(int32_t const number)
+    : next(NULLPTR)
+    , count(number)
+    , granted(0) {
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_FAIRSEMAPHORE_HPP_
@@ -0,0 +1,70 @@
+/**
+ * @file      sys.Futex.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_FUTEX_HPP_
+#define SYS_FUTEX_HPP_
+
+#include "sys.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Futex
+ * @brief Fast user-space locking primitive of the Linux kernel.
+ *
+ * @note The class operates on process private futex words only.
+ */
+class Futex
+{
+
+public:
+
+    /**
+     * @brief Blocks the caller while the futex word equals the expected value.
+     *
+     * @param word  Address of the futex word.
+     * @param value Expected value of the futex word.
+     * @return True if woken up, interrupted or the word does not equal the expected value.
+     */
+    static bool_t wait(int32_t* word, int32_t value);
+
+    /**
+     * @brief Blocks the caller while the futex word equals the expected value until a deadline.
+     *
+     * @param word     Address of the futex word.
+     * @param value    Expected value of the futex word.
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock.
+     * @return True if woken up, interrupted or the word does not equal the expected value, false if timed out.
+     */
+    static bool_t wait(int32_t* word, int32_t value, ::timespec const& deadline);
+
+    /**
+     * @brief Wakes up threads blocked on the futex word.
+     *
+     * @param word  Address of the futex word.
+     * @param count Maximum number of threads to be woken up.
+     * @return Number of threads woken up, or -1 if an error occurred.
+     */
+    static int32_t wake(int32_t* word, int32_t count);
+
+    /**
+     * @brief Wakes up threads blocked on the futex word and moves the others to a target futex word.
+     *
+     * @param word   Address of the futex word.
+     * @param value  Expected value of the futex word.
+     * @param count  Maximum number of threads to be woken up.
+     * @param target Address of the target futex word.
+     * @return Number of threads woken up and moved, or -1 if an error occurred or the word does not equal the expected value.
+     */
+    static int32_t requeue(int32_t* word, int32_t value, int32_t count, int32_t* target);
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_FUTEX_HPP_
@@ -0,0 +1,302 @@
+/**
+ * @file      sys.FutexSemaphore.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_FUTEXSEMAPHORE_HPP_
+#define SYS_FUTEXSEMAPHORE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Semaphore.hpp"
+#include "sys.Futex.hpp"
+#include "sys.Spin.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class FutexSemaphore
+ * @brief Semaphore class on a futex word.
+ *
+ * Permits are counted by an atomic futex word. An acquirer spins for a while before blocking,
+ * the spin limit adapts to how long permits used to take to be released. Waiters are counted,
+ * so the release makes a system call only if there is a blocked acquirer.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class FutexSemaphore EOOS_SYS_FINAL : public NonCopyable<A>, public api::Semaphore
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param permits The initial number of permits available.
+     */
+    explicit FutexSemaphore(int32_t permits);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~FutexSemaphore();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Semaphore::acquire()
+     */
+    virtual bool_t acquire();
+
+    /**
+     * @copydoc eoos::api::Semaphore::release()
+     */
+    virtual bool_t release();
+
+    /**
+     * @brief Acquires a number of permits at once.
+     *
+     * @param count Number of permits.
+     * @return True if the permits have been acquired.
+     */
+    bool_t acquire(int32_t count);
+
+    /**
+     * @brief Releases a number of permits at once.
+     *
+     * @param count Number of permits.
+     * @return True if the permits have been released.
+     */
+    bool_t release(int32_t count);
+
+    /**
+     * @brief Acquires one permit if it is available.
+     *
+     * @return True if the permit has been acquired.
+     */
+    bool_t tryAcquire();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Maximum number of spins before an acquirer blocks on multiprocessor systems.
+     */
+    static const int32_t SPIN_COUNT = 100;
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Takes permits if they are available.
+     *
+     * @param count Number of permits.
+     * @return True if the permits have been taken.
+     */
+    bool_t take(int32_t count);
+
+    /**
+     * @brief Spins while not enough permits are available.
+     *
+     * @param count Number of permits.
+     * @return True if the permits have been taken while spinning.
+     */
+    bool_t spin(int32_t count);
+
+    /**
+     * @brief Number of permits available as futex word.
+     */
+    int32_t permits_;
+
+    /**
+     * @brief Number of blocked acquirers.
+     */
+    int32_t waiters_;
+
+    /**
+     * @brief Number of blocked acquirers of more than one permit.
+     */
+    int32_t batchers_;
+
+    /**
+     * @brief Average number of spins a permit used to be taken in.
+     */
+    int32_t spins_;
+
+};
+
+template <class A>
+FutexSemaphore<A>::FutexSemaphore(int32_t const permits)
+    : NonCopyable<A>()
+    , api::Semaphore()
+    , permits_(permits)
+    , waiters_(0)
+    , batchers_(0)
+    , spins_(0) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+FutexSemaphore<A>::~FutexSemaphore()
+{
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::isConstructed() const ///< SCA MISRA-C++:2008 Justified Rule 10-3-1
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::acquire()
+{
+    return acquire(1);
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::release()
+{
+    return release(1);
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::acquire(int32_t const count)
+{
+    bool_t res( false );
+    if( Parent::isUsable() && (count > 0) )
+    {
+        res = take(count) || spin(count);
+        if( !res )
+        {
+            static_cast<void>( __atomic_add_fetch(&waiters_, 1, __ATOMIC_SEQ_CST) );
+            if( count > 1 )
+            {
+                static_cast<void>( __atomic_add_fetch(&batchers_, 1, __ATOMIC_SEQ_CST) );
+            }
+            while( !take(count) )
+            {
+                int32_t const permits( __atomic_load_n(&permits_, __ATOMIC_SEQ_CST) );
+                if( permits < count )
+                {
+                    static_cast<void>( Futex::wait(&permits_, permits) );
+                }
+            }
+            if( count > 1 )
+            {
+                static_cast<void>( __atomic_sub_fetch(&batchers_, 1, __ATOMIC_RELAXED) );
+            }
+            static_cast<void>( __atomic_sub_fetch(&waiters_, 1, __ATOMIC_RELAXED) );
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::release(int32_t const count)
+{
+    bool_t res( false );
+    if( Parent::isUsable() && (count > 0) )
+    {
+        int32_t permits( __atomic_load_n(&permits_, __ATOMIC_RELAXED) );
+        while( permits <= (INT_MAX - count) )
+        {
+            if( __atomic_compare_exchange_n(&permits_, &permits, permits + count, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) )
+            {
+                res = true;
+                break;
+            }
+        }
+        if( res && (__atomic_load_n(&waiters_, __ATOMIC_SEQ_CST) > 0) )
+        {
+            // A waiter for more permits than released might be woken up instead of the ones they fit,
+            // so all waiters are woken up if there is such one, and they take the permits they need.
+            int32_t const number( (__atomic_load_n(&batchers_, __ATOMIC_SEQ_CST) > 0) ? INT_MAX : count );
+            static_cast<void>( Futex::wake(&permits_, number) );
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::tryAcquire()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        res = take(1);
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::construct()
+{
+    bool_t res( false );
+    if( isConstructed() && (permits_ >= 0) )
+    {
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::take(int32_t const count)
+{
+    bool_t res( false );
+    int32_t permits( __atomic_load_n(&permits_, __ATOMIC_SEQ_CST) );
+    while( permits >= count )
+    {
+        if( __atomic_compare_exchange_n(&permits_, &permits, permits - count, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) )
+        {
+            res = true;
+            break;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::spin(int32_t const count)
+{
+    bool_t res( false );
+    int32_t const maximum( Spin::getCount(SPIN_COUNT) );
+    if( maximum > 0 )
+    {
+        int32_t const spins( __atomic_load_n(&spins_, __ATOMIC_RELAXED) );
+        int32_t const limit( ( (spins * 2) + 10 < maximum ) ? (spins * 2) + 10 : maximum );
+        int32_t spun( 0 );
+        while( spun < limit )
+        {
+            ++spun;
+            Spin::relax();
+            if( take(count) )
+            {
+                res = true;
+                break;
+            }
+        }
+        // Moves the average an eighth toward the spins made this time
+        __atomic_store_n(&spins_, spins + ( (spun - spins) / 8 ), __ATOMIC_RELAXED);
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_FUTEXSEMAPHORE_HPP_
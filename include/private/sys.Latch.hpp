@@ -0,0 +1,176 @@
+/**
+ * @file      sys.Latch.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_LATCH_HPP_
+#define SYS_LATCH_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Futex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Latch
+ * @brief One-shot countdown latch class.
+ *
+ * Waiters wait on the counter futex word, and the count down to zero wakes
+ * all the waiters up by one futex broadcast.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class Latch EOOS_SYS_FINAL : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param count Initial counter value.
+     */
+    explicit Latch(int32_t count);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Latch();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Decrements the counter.
+     *
+     * @param number A number to decrement the counter by, which is limited by the counter value.
+     * @return True if the counter has been decremented.
+     */
+    bool_t countDown(int32_t number);
+
+    /**
+     * @brief Waits until the counter reaches zero.
+     *
+     * @return True if the counter has reached zero.
+     */
+    bool_t wait();
+
+    /**
+     * @brief Tests if the counter has reached zero.
+     *
+     * @return True if the counter has reached zero.
+     */
+    bool_t tryWait() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Counter as futex word.
+     */
+    int32_t count_;
+
+};
+
+template <class A>
+Latch<A>::Latch(int32_t const count)
+    : NonCopyable<A>()
+    , count_(count) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+Latch<A>::~Latch()
+{
+}
+
+template <class A>
+bool_t Latch<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t Latch<A>::countDown(int32_t const number)
+{
+    bool_t res( false );
+    if( isConstructed() && (number > 0) )
+    {
+        int32_t count( __atomic_load_n(&count_, __ATOMIC_RELAXED) );
+        while( count > 0 )
+        {
+            int32_t const next( (count > number) ? (count - number) : 0 );
+            if( __atomic_compare_exchange_n(&count_, &count, next, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED) )
+            {
+                if( next == 0 )
+                {
+                    static_cast<void>( Futex::wake(&count_, INT_MAX) );
+                }
+                res = true;
+                break;
+            }
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t Latch<A>::wait()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        int32_t count( __atomic_load_n(&count_, __ATOMIC_ACQUIRE) );
+        while( count > 0 )
+        {
+            static_cast<void>( Futex::wait(&count_, count) );
+            count = __atomic_load_n(&count_, __ATOMIC_ACQUIRE);
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t Latch<A>::tryWait() const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = __atomic_load_n(&count_, __ATOMIC_ACQUIRE) == 0;
+    }
+    return res;
+}
+
+template <class A>
+bool_t Latch<A>::construct()
+{
+    bool_t res( false );
+    if( isConstructed() && (count_ >= 0) )
+    {
+        res = true;
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_LATCH_HPP_
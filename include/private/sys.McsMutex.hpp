@@ -0,0 +1,308 @@
+/**
+ * @file      sys.McsMutex.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_MCSMUTEX_HPP_
+#define SYS_MCSMUTEX_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Mutex.hpp"
+#include "sys.Futex.hpp"
+#include "sys.Spin.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class McsMutex.
+ * @brief MCS queue mutex class.
+ *
+ * Each waiter spins on its own cache line node placed on its stack, and the lock is handed off
+ * to waiters in FIFO order. A waiter which has not got the lock after a number of spins parks itself
+ * on its node futex word. The mutex does not keep the owner node after the lock is acquired.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class McsMutex EOOS_SYS_FINAL : public NonCopyable<A>, public api::Mutex
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    McsMutex();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~McsMutex();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Mutex::tryLock()
+     */
+    virtual bool_t tryLock();
+
+    /**
+     * @copydoc eoos::api::Mutex::lock()
+     */
+    virtual bool_t lock();
+
+    /**
+     * @copydoc eoos::api::Mutex::unlock()
+     */
+    virtual bool_t unlock();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Number of spins before a waiter parks itself on multiprocessor systems.
+     */
+    static const int32_t SPIN_COUNT = 1000;
+
+    /**
+     * @enum State
+     * @brief Waiter node states.
+     */
+    enum State
+    {
+        STATE_GRANTED = 0, ///< @brief The lock is handed off to the waiter
+        STATE_WAITING = 1, ///< @brief The waiter spins
+        STATE_PARKED  = 2  ///< @brief The waiter sleeps on the futex word
+    };
+
+    /**
+     * @struct Node
+     * @brief Queue node of a waiter.
+     */
+    struct __attribute__((aligned(EOOS_GLOBAL_SYS_CACHE_LINE_SIZE))) Node
+    {
+        /**
+         * @brief Constructor.
+         *
+         * @param initial Initial state.
+         */
+        explicit Node(int32_t initial);
+
+        /**
+         * @brief Next waiter node.
+         */
+        Node* next; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Waiter state as futex word.
+         */
+        int32_t state; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Waits until the lock is handed off to a node.
+     *
+     * @param node A waiter node.
+     */
+    static void wait(Node& node);
+
+    /**
+     * @brief Hands off the lock to a node.
+     *
+     * @param node A waiter node.
+     */
+    static void grant(Node& node);
+
+    /**
+     * @brief Lock node which next field is the node of the owner successor.
+     */
+    Node head_;
+
+    /**
+     * @brief Last node in the queue, or null pointer if the mutex is unlocked.
+     */
+    Node* tail_;
+
+};
+
+template <class A>
+McsMutex<A>::McsMutex()
+    : NonCopyable<A>()
+    , api::Mutex()
+    , head_(STATE_GRANTED)
+    , tail_(NULLPTR) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+McsMutex<A>::~McsMutex()
+{
+}
+
+template <class A>
+bool_t McsMutex<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t McsMutex<A>::tryLock()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        Node* expected( NULLPTR );
+        res = __atomic_compare_exchange_n(&tail_, &expected, &head_, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+    }
+    return res;
+}
+
+template <class A>
+bool_t McsMutex<A>::lock()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        while( !res )
+        {
+            Node* pred( __atomic_load_n(&tail_, __ATOMIC_ACQUIRE) );
+            if( pred == NULLPTR )
+            {
+                res = __atomic_compare_exchange_n(&tail_, &pred, &head_, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+                continue;
+            }
+            Node node(STATE_WAITING);
+            if( !__atomic_compare_exchange_n(&tail_, &pred, &node, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) )
+            {
+                continue;
+            }
+            __atomic_store_n(&pred->next, &node, __ATOMIC_RELEASE);
+            wait(node);
+            // The lock is owned, so move the successor to the lock node as the node is on the stack
+            Node* succ( __atomic_load_n(&node.next, __ATOMIC_ACQUIRE) );
+            if( succ == NULLPTR )
+            {
+                __atomic_store_n(&head_.next, succ, __ATOMIC_RELAXED);
+                Node* expected( &node );
+                if( !__atomic_compare_exchange_n(&tail_, &expected, &head_, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) )
+                {
+                    // A new waiter has been queued but has not linked itself yet
+                    do
+                    {
+                        Spin::relax();
+                        succ = __atomic_load_n(&node.next, __ATOMIC_ACQUIRE);
+                    }
+                    while( succ == NULLPTR );
+                    __atomic_store_n(&head_.next, succ, __ATOMIC_RELAXED);
+                }
+            }
+            else
+            {
+                __atomic_store_n(&head_.next, succ, __ATOMIC_RELAXED);
+            }
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t McsMutex<A>::unlock()
+{
+    bool_t res( false );
+    if( Parent::isUsable() && (__atomic_load_n(&tail_, __ATOMIC_RELAXED) != NULLPTR) )
+    {
+        Node* succ( __atomic_load_n(&head_.next, __ATOMIC_ACQUIRE) );
+        if( succ == NULLPTR )
+        {
+            Node* expected( &head_ );
+            Node* const desired( NULLPTR );
+            if( !__atomic_compare_exchange_n(&tail_, &expected, desired, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED) )
+            {
+                // A new waiter has been queued but has not linked itself yet
+                do
+                {
+                    Spin::relax();
+                    succ = __atomic_load_n(&head_.next, __ATOMIC_ACQUIRE);
+                }
+                while( succ == NULLPTR );
+            }
+        }
+        if( succ != NULLPTR )
+        {
+            grant(*succ);
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t McsMutex<A>::construct()
+{
+    return isConstructed();
+}
+
+template <class A>
+void McsMutex<A>::wait(Node& node)
+{
+    int32_t spin( Spin::getCount(SPIN_COUNT) );
+    while( __atomic_load_n(&node.state, __ATOMIC_ACQUIRE) != STATE_GRANTED )
+    {
+        if( spin > 0 )
+        {
+            --spin;
+            Spin::relax();
+        }
+        else
+        {
+            int32_t expected( STATE_WAITING );
+            static_cast<void>( __atomic_compare_exchange_n(&node.state, &expected, STATE_PARKED, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) );
+            if( expected != STATE_GRANTED )
+            {
+                static_cast<void>( Futex::wait(&node.state, STATE_PARKED) );
+            }
+        }
+    }
+}
+
+template <class A>
+void McsMutex<A>::grant(Node& node)
+{
+    int32_t const state( __atomic_exchange_n(&node.state, STATE_GRANTED, __ATOMIC_ACQ_REL) );
+    if( state == STATE_PARKED )
+    {
+        // The node might already be out of the waiter stack frame, but the stack is still mapped
+        // and a spurious wake-up of a futex word at the same address is legal for any futex user.
+        static_cast<void>( Futex::wake(&node.state, 1) );
+    }
+}
+
+template <class A>
+McsMutex<A>::Node::Node(int32_t const initial)
+    : next(NULLPTR)
+    , state(initial) {
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_MCSMUTEX_HPP_
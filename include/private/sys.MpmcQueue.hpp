@@ -0,0 +1,378 @@
+/**
+ * @file      sys.MpmcQueue.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_MPMCQUEUE_HPP_
+#define SYS_MPMCQUEUE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.QueueEvent.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class MpmcQueue
+ * @brief Bounded multi-producer multi-consumer queue class.
+ *
+ * The queue is a ring of cells each of which has a sequence number. A producer claims a cell by moving
+ * the producer counter with a CAS when the cell sequence tells the cell is free, and publishes the element
+ * by advancing the cell sequence. A consumer claims and frees a cell the same way, so producers and
+ * consumers do not contend with each other for anything but the cells. A blocking queue blocks producers
+ * on a full queue and consumers on an empty queue on futex events.
+ *
+ * @tparam A Heap memory allocator class.
+ * @tparam L Maximum number of elements, which shall be a power of two.
+ */
+template <class A, int32_t L>
+class MpmcQueue EOOS_SYS_FINAL : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param isBlocking True if producers and consumers block on a full and an empty queue.
+     */
+    explicit MpmcQueue(bool_t isBlocking);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~MpmcQueue();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Puts an element to the tail of the queue waiting while it is full if the queue is blocking.
+     *
+     * @param element An element.
+     * @return True if the element has been put.
+     */
+    bool_t push(void* element);
+
+    /**
+     * @brief Takes an element from the head of the queue waiting while it is empty if the queue is blocking.
+     *
+     * @param element An element taken.
+     * @return True if an element has been taken.
+     */
+    bool_t pop(void*& element);
+
+    /**
+     * @brief Puts an element to the tail of the queue if it is not full.
+     *
+     * @param element An element.
+     * @return True if the element has been put.
+     */
+    bool_t tryPush(void* element);
+
+    /**
+     * @brief Takes an element from the head of the queue if it is not empty.
+     *
+     * @param element An element taken.
+     * @return True if an element has been taken.
+     */
+    bool_t tryPop(void*& element);
+
+    /**
+     * @brief Returns maximum number of elements.
+     *
+     * @return Maximum number of elements.
+     */
+    int32_t getLength() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @struct Cell
+     * @brief Queue cell.
+     */
+    struct Cell
+    {
+        /**
+         * @brief Sequence number which equals the producer counter the cell is free for,
+         *        or the consumer counter plus one the cell is full for.
+         */
+        uint32_t sequence; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Element.
+         */
+        void* element; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+    };
+
+    /**
+     * @brief Mask of a cell index.
+     */
+    static const uint32_t MASK = static_cast<uint32_t>(L) - 1U;
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Puts an element if the queue is not full.
+     *
+     * @param element An element.
+     * @return True if the element has been put.
+     */
+    bool_t put(void* element);
+
+    /**
+     * @brief Takes an element if the queue is not empty.
+     *
+     * @param element An element taken.
+     * @return True if an element has been taken.
+     */
+    bool_t take(void*& element);
+
+    /**
+     * @brief Producer counter of cells claimed.
+     */
+    uint32_t tail_;
+
+    /**
+     * @brief Padding of the producer counter to a cache line.
+     */
+    uint8_t tailPadding_[EOOS_GLOBAL_SYS_CACHE_LINE_SIZE - sizeof(uint32_t)];
+
+    /**
+     * @brief Consumer counter of cells claimed.
+     */
+    uint32_t head_;
+
+    /**
+     * @brief Padding of the consumer counter to a cache line.
+     */
+    uint8_t headPadding_[EOOS_GLOBAL_SYS_CACHE_LINE_SIZE - sizeof(uint32_t)];
+
+    /**
+     * @brief Cells of the elements.
+     */
+    Cell cells_[L];
+
+    /**
+     * @brief Blocking flag.
+     */
+    bool_t isBlocking_;
+
+    /**
+     * @brief Event of an element put.
+     */
+    QueueEvent notEmpty_;
+
+    /**
+     * @brief Event of an element taken.
+     */
+    QueueEvent notFull_;
+
+};
+
+template <class A, int32_t L>
+MpmcQueue<A,L>::MpmcQueue(bool_t const isBlocking)
+    : NonCopyable<A>()
+    , tail_(0U)
+    , tailPadding_()
+    , head_(0U)
+    , headPadding_()
+    , cells_()
+    , isBlocking_(isBlocking)
+    , notEmpty_()
+    , notFull_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A, int32_t L>
+MpmcQueue<A,L>::~MpmcQueue()
+{
+}
+
+template <class A, int32_t L>
+bool_t MpmcQueue<A,L>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A, int32_t L>
+bool_t MpmcQueue<A,L>::push(void* const element)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = put(element);
+        while( !res && isBlocking_ )
+        {
+            int32_t const sequence( notFull_.enter() );
+            res = put(element);
+            if( !res )
+            {
+                notFull_.wait(sequence);
+            }
+            notFull_.leave();
+        }
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+bool_t MpmcQueue<A,L>::pop(void*& element)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = take(element);
+        while( !res && isBlocking_ )
+        {
+            int32_t const sequence( notEmpty_.enter() );
+            res = take(element);
+            if( !res )
+            {
+                notEmpty_.wait(sequence);
+            }
+            notEmpty_.leave();
+        }
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+bool_t MpmcQueue<A,L>::tryPush(void* const element)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = put(element);
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+bool_t MpmcQueue<A,L>::tryPop(void*& element)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = take(element);
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+int32_t MpmcQueue<A,L>::getLength() const
+{
+    return L;
+}
+
+template <class A, int32_t L>
+bool_t MpmcQueue<A,L>::construct()
+{
+    bool_t res( false );
+    if( isConstructed() && (L > 0) && ( (static_cast<uint32_t>(L) & MASK) == 0U ) )
+    {
+        for(uint32_t i(0U); i < static_cast<uint32_t>(L); ++i)
+        {
+            cells_[i].sequence = i;
+            cells_[i].element = NULLPTR;
+        }
+        res = notEmpty_.isConstructed() && notFull_.isConstructed();
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+bool_t MpmcQueue<A,L>::put(void* const element)
+{
+    bool_t res( false );
+    uint32_t tail( __atomic_load_n(&tail_, __ATOMIC_RELAXED) );
+    while( true )
+    {
+        Cell& cell( cells_[tail & MASK] );
+        uint32_t const sequence( __atomic_load_n(&cell.sequence, __ATOMIC_ACQUIRE) );
+        int32_t const difference( static_cast<int32_t>(sequence - tail) );
+        if( difference == 0 )
+        {
+            // The cell is free for this counter value, and it is claimed if no producer has claimed it
+            if( __atomic_compare_exchange_n(&tail_, &tail, tail + 1U, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED) )
+            {
+                cell.element = element;
+                __atomic_store_n(&cell.sequence, tail + 1U, __ATOMIC_RELEASE);
+                res = true;
+                break;
+            }
+        }
+        else if( difference < 0 )
+        {
+            // The cell has not been freed by a consumer since the previous lap, so the queue is full
+            break;
+        }
+        else
+        {
+            tail = __atomic_load_n(&tail_, __ATOMIC_RELAXED);
+        }
+    }
+    if( res && isBlocking_ )
+    {
+        notEmpty_.signal();
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+bool_t MpmcQueue<A,L>::take(void*& element)
+{
+    bool_t res( false );
+    uint32_t head( __atomic_load_n(&head_, __ATOMIC_RELAXED) );
+    while( true )
+    {
+        Cell& cell( cells_[head & MASK] );
+        uint32_t const sequence( __atomic_load_n(&cell.sequence, __ATOMIC_ACQUIRE) );
+        int32_t const difference( static_cast<int32_t>(sequence - (head + 1U)) );
+        if( difference == 0 )
+        {
+            // The cell is full for this counter value, and it is claimed if no consumer has claimed it
+            if( __atomic_compare_exchange_n(&head_, &head, head + 1U, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED) )
+            {
+                element = cell.element;
+                __atomic_store_n(&cell.sequence, head + static_cast<uint32_t>(L), __ATOMIC_RELEASE);
+                res = true;
+                break;
+            }
+        }
+        else if( difference < 0 )
+        {
+            // The cell has not been filled by a producer yet, so the queue is empty
+            break;
+        }
+        else
+        {
+            head = __atomic_load_n(&head_, __ATOMIC_RELAXED);
+        }
+    }
+    if( res && isBlocking_ )
+    {
+        notFull_.signal();
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_MPMCQUEUE_HPP_
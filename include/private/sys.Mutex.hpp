@@ -21,7 +21,7 @@ namespace sys
  * @tparam A Heap memory allocator class.
  */
 template <class A>
-class Mutex : public NonCopyable<A>, public api::Mutex
+class Mutex EOOS_SYS_FINAL : public NonCopyable<A>, public api::Mutex
 {
     typedef NonCopyable<A> Parent;
 
@@ -114,7 +114,7 @@ template <class A>
 bool_t Mutex<A>::tryLock()
 {
     bool_t res( false );
-    if( isConstructed() )
+    if( Parent::isUsable() )
     {
         int_t const error( ::pthread_mutex_trylock(&mutex_) );
         res = (error == 0) ? true : false;
@@ -126,7 +126,7 @@ template <class A>
 bool_t Mutex<A>::lock()
 {
     bool_t res( false );
-    if( isConstructed() )
+    if( Parent::isUsable() )
     {
         int_t const error( ::pthread_mutex_lock(&mutex_) );
         if( error == 0 ) 
@@ -141,7 +141,7 @@ template <class A>
 bool_t Mutex<A>::unlock()
 {
     bool_t res( false );
-    if( isConstructed() )
+    if( Parent::isUsable() )
     {
         int_t const error( ::pthread_mutex_unlock(&mutex_) );
         if( error == 0 )
@@ -9,7 +9,10 @@
 #include "sys.NonCopyable.hpp"
 #include "api.MutexManager.hpp"
 #include "sys.Mutex.hpp"
-#include "lib.ResourceMemory.hpp"
+#include "sys.McsMutex.hpp"
+#include "sys.SharedMutex.hpp"
+#include "sys.ResourceMemory.hpp"
+#include "sys.ResourceArray.hpp"
 
 namespace eoos
 {
@@ -23,10 +26,33 @@ namespace sys
 class MutexManager : public NonCopyable<NoAllocator>, public api::MutexManager
 {
     typedef NonCopyable<NoAllocator> Parent;
-    typedef Mutex<MutexManager> Resource;
 
 public:
 
+    /**
+     * @brief Mutex the manager creates, which calls of lock and unlock are bound statically through.
+     */
+    #ifdef EOOS_GLOBAL_SYS_MUTEX_MCS
+    typedef McsMutex<MutexManager> Resource;
+    #else
+    typedef Mutex<MutexManager> Resource;
+    #endif // EOOS_GLOBAL_SYS_MUTEX_MCS
+
+    /**
+     * @brief Mutex shared by processes, which reports death of an owner process to its lockers.
+     */
+    typedef SharedMutex<MutexManager> SharedResource;
+
+    /**
+     * @brief Caller provided memory a mutex can be created in.
+     */
+    typedef ResourceStorage<Resource> Storage;
+
+    /**
+     * @brief Array of mutexes placed in one memory block.
+     */
+    typedef ResourceArray<Resource, MutexManager> Array;
+
     /**
      * @brief Constructor.
      */
@@ -45,7 +71,58 @@ public:
     /**
      * @copydoc eoos::api::MutexManager::create()
      */
-    virtual api::Mutex* create();
+    virtual Resource* create();
+
+    /**
+     * @brief Creates a new mutex resource in caller provided memory.
+     *
+     * @note The resource shall be destroyed by destroy() before the memory is released or reused.
+     *
+     * @param storage Memory the mutex is created in.
+     * @return A new mutex resource, or NULLPTR if an error has been occurred.
+     */
+    Resource* create(Storage& storage);
+
+    /**
+     * @brief Destroys a mutex resource created in caller provided memory.
+     *
+     * @param storage Memory a mutex resource has been created in by create(Storage&) which did not return NULLPTR.
+     */
+    void destroy(Storage& storage);
+
+    /**
+     * @brief Creates a new array of mutex resources placed in one memory block.
+     *
+     * @note The array and all its mutexes are released at once by deleting the array.
+     *
+     * @param length Number of mutexes.
+     * @return A new array of mutex resources, or NULLPTR if an error has been occurred.
+     */
+    Array* createArray(int32_t length);
+
+    /**
+     * @brief Creates a new mutex resource shared by processes.
+     *
+     * @param name Name of a shared memory object the mutex is placed in, which starts with a slash.
+     * @return A new mutex resource, or NULLPTR if an error has been occurred.
+     */
+    SharedResource* createShared(char_t const* name);
+
+    /**
+     * @brief Removes name of a shared memory object of mutexes shared by processes.
+     *
+     * @param name Name of a shared memory object which starts with a slash.
+     * @return True if the name is removed.
+     */
+    bool_t removeShared(char_t const* name);
+
+    /**
+     * @brief Returns statistics of the resource memory pool.
+     *
+     * @param statistics Statistics the pool statistics are copied to.
+     * @return True if the statistics are got.
+     */
+    bool_t getStatistics(ResourceStatistics& statistics) const;
 
     /**
      * @brief Allocates memory.
@@ -87,6 +164,11 @@ private:
      * @brief Initializes the allocator.
      */
     static void deinitialize();
+
+    /**
+     * @brief Pool slot of a mutex of any type.
+     */
+    typedef ResourceSlot<Resource, SharedResource> Slot;
     
     /**
      * @struct ResourcePool
@@ -102,19 +184,10 @@ private:
          */        
         ResourcePool();
 
-    private:
-            
-        /**
-         * @brief Mutex resource.
-         */    
-        Mutex<NoAllocator> mutex_;
-        
-    public:
-        
         /**
          * @brief Mutex memory allocator.
          */     
-        lib::ResourceMemory<Resource, EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXS> memory;
+        ResourceMemory<Slot, EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXS> memory;
 
     };
 
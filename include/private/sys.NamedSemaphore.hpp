@@ -0,0 +1,252 @@
+/**
+ * @file      sys.NamedSemaphore.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_NAMEDSEMAPHORE_HPP_
+#define SYS_NAMEDSEMAPHORE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Semaphore.hpp"
+#include "sys.Clock.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class NamedSemaphore
+ * @brief POSIX named semaphore shared by processes.
+ *
+ * The semaphore is opened by its name, and the number of permits is set by
+ * the process which creates the semaphore first.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class NamedSemaphore EOOS_SYS_FINAL : public NonCopyable<A>, public api::Semaphore
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param name    Name of a semaphore which starts with a slash.
+     * @param permits The initial number of permits available.
+     */
+    NamedSemaphore(char_t const* name, int32_t permits);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~NamedSemaphore();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Semaphore::acquire()
+     */
+    virtual bool_t acquire();
+
+    /**
+     * @copydoc eoos::api::Semaphore::release()
+     */
+    virtual bool_t release();
+
+    /**
+     * @brief Acquires one permit if it is available.
+     *
+     * @return True if the permit has been acquired.
+     */
+    bool_t tryAcquire();
+
+    /**
+     * @brief Acquires one permit waiting for it for a time.
+     *
+     * @param timeout Relative time to wait.
+     * @return True if the permit has been acquired, false if timed out or an error occurred.
+     */
+    bool_t acquire(::timespec const& timeout);
+
+    /**
+     * @brief Acquires one permit waiting for it until a deadline.
+     *
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock.
+     * @return True if the permit has been acquired, false if timed out or an error occurred.
+     */
+    bool_t acquireUntil(::timespec const& deadline);
+
+    /**
+     * @brief Removes a semaphore name.
+     *
+     * @note Opened semaphores of the name stay usable until they are closed.
+     *
+     * @param name Name of a semaphore which starts with a slash.
+     * @return True if the name is removed.
+     */
+    static bool_t remove(char_t const* name);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param name    Name of a semaphore which starts with a slash.
+     * @param permits The initial number of permits available.
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct(char_t const* name, int32_t permits);
+
+    /**
+     * @brief Semaphore resource identifier.
+     */
+    ::sem_t* sem_;
+
+};
+
+template <class A>
+NamedSemaphore<A>::NamedSemaphore(char_t const* const name, int32_t const permits)
+    : NonCopyable<A>()
+    , api::Semaphore()
+    , sem_(SEM_FAILED) {
+    bool_t const isConstructed( construct(name, permits) );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+NamedSemaphore<A>::~NamedSemaphore()
+{
+    if( sem_ != SEM_FAILED )
+    {
+        static_cast<void>( ::sem_close(sem_) );
+    }
+}
+
+template <class A>
+bool_t NamedSemaphore<A>::isConstructed() const ///< SCA MISRA-C++:2008 Justified Rule 10-3-1
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t NamedSemaphore<A>::acquire()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        int_t error( ::sem_wait(sem_) );
+        // A signal handler interrupts the wait, which is then continued
+        while( (error != 0) && (errno == EINTR) )
+        {
+            error = ::sem_wait(sem_);
+        }
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t NamedSemaphore<A>::release()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        int_t const error( ::sem_post(sem_) );
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t NamedSemaphore<A>::tryAcquire()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        int_t const error( ::sem_trywait(sem_) );
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t NamedSemaphore<A>::acquire(::timespec const& timeout)
+{
+    bool_t res( false );
+    ::timespec deadline;
+    if( Clock::getDeadline(timeout, deadline) )
+    {
+        res = acquireUntil(deadline);
+    }
+    return res;
+}
+
+template <class A>
+bool_t NamedSemaphore<A>::acquireUntil(::timespec const& deadline)
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        int_t error( ::sem_clockwait(sem_, CLOCK_MONOTONIC, &deadline) );
+        // A signal handler interrupts the wait, which is then continued until the same deadline
+        while( (error != 0) && (errno == EINTR) )
+        {
+            error = ::sem_clockwait(sem_, CLOCK_MONOTONIC, &deadline);
+        }
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t NamedSemaphore<A>::remove(char_t const* const name)
+{
+    bool_t res( false );
+    if( name != NULLPTR )
+    {
+        int_t const error( ::sem_unlink(name) );
+        res = error == 0;
+    }
+    return res;
+}
+
+template <class A>
+bool_t NamedSemaphore<A>::construct(char_t const* const name, int32_t const permits)
+{
+    bool_t res( false );
+    if( isConstructed() && (name != NULLPTR) && (permits >= 0) )
+    {
+        sem_ = ::sem_open(name, O_CREAT, 0600, static_cast<uint_t>(permits));
+        if( sem_ != SEM_FAILED )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_NAMEDSEMAPHORE_HPP_
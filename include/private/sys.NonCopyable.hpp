@@ -34,6 +34,15 @@ public:
      * @brief Destructor.
      */
     virtual ~NonCopyable();
+
+protected:
+
+    /**
+     * @brief Tests if this object can be used.
+     *
+     * @return True if this object is constructed, or always true if the checks are removed.
+     */
+    bool_t isUsable() const;
     
 private:
     
@@ -73,6 +82,16 @@ NonCopyable<A>::~NonCopyable()
 {
 }
 
+template <class A>
+inline bool_t NonCopyable<A>::isUsable() const
+{
+    #ifdef EOOS_GLOBAL_SYS_NO_CONSTRUCTED_CHECKS
+    return true;
+    #else
+    return Object<A>::isConstructed();
+    #endif // EOOS_GLOBAL_SYS_NO_CONSTRUCTED_CHECKS
+}
+
 } // namespace sys
 } // namespace eoos
 #endif // SYS_NONCOPYABLE_HPP_
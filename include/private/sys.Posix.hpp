@@ -15,6 +15,18 @@
 #include <sched.h>
 #include <unistd.h>
 #include <stdio.h> ///< SCA MISRA-C++:2008 Justified Rule 18-0-1 and Rule 27-0-1
+#include <string.h> ///< SCA MISRA-C++:2008 Justified Rule 18-0-1
 #include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <signal.h>
+#include <linux/membarrier.h>
 
 #endif // SYS_POSIX_HPP_
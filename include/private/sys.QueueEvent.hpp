@@ -0,0 +1,82 @@
+/**
+ * @file      sys.QueueEvent.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_QUEUEEVENT_HPP_
+#define SYS_QUEUEEVENT_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.NoAllocator.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class QueueEvent
+ * @brief Event of a queue state change which queue users block on.
+ *
+ * The event is a futex word sequence which is advanced each time the event is signaled.
+ * Waiters are counted, so the signal makes a system call only if there is a blocked waiter.
+ *
+ * A waiter enters the event, tests the queue again, waits if the test fails, and leaves the event.
+ */
+class QueueEvent : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    QueueEvent();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~QueueEvent();
+
+    /**
+     * @brief Signals the event and wakes up one waiter.
+     */
+    void signal();
+
+    /**
+     * @brief Registers the caller as a waiter.
+     *
+     * @return The sequence to wait on.
+     */
+    int32_t enter();
+
+    /**
+     * @brief Blocks the caller until the event is signaled.
+     *
+     * @param sequence The sequence returned by enter function.
+     */
+    void wait(int32_t sequence);
+
+    /**
+     * @brief Unregisters the caller as a waiter.
+     */
+    void leave();
+
+private:
+
+    /**
+     * @brief Event sequence as futex word.
+     */
+    int32_t sequence_;
+
+    /**
+     * @brief Number of waiters.
+     */
+    int32_t waiters_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_QUEUEEVENT_HPP_
@@ -0,0 +1,150 @@
+/**
+ * @file      sys.QueueManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_QUEUEMANAGER_HPP_
+#define SYS_QUEUEMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.SpscQueue.hpp"
+#include "sys.MpmcQueue.hpp"
+#include "sys.ResourceMemory.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class QueueManager.
+ * @brief Queue sub-system manager.
+ *
+ * The queues are of EOOS_GLOBAL_SYS_QUEUE_LENGTH elements, which are kept in the queue objects,
+ * so the queues and their elements are allocated in one pool slot.
+ */
+class QueueManager : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+    typedef SpscQueue<QueueManager, EOOS_GLOBAL_SYS_QUEUE_LENGTH> SpscResource;
+    typedef MpmcQueue<QueueManager, EOOS_GLOBAL_SYS_QUEUE_LENGTH> MpmcResource;
+    typedef ResourceSlot<SpscResource, MpmcResource> Slot;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    QueueManager();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~QueueManager();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Creates a new single-producer single-consumer queue resource.
+     *
+     * @param isBlocking True if the producer and the consumer block on a full and an empty queue.
+     * @return A new queue resource, or NULLPTR if an error has been occurred.
+     */
+    SpscQueue<QueueManager, EOOS_GLOBAL_SYS_QUEUE_LENGTH>* createSpsc(bool_t isBlocking);
+
+    /**
+     * @brief Creates a new multi-producer multi-consumer queue resource.
+     *
+     * @param isBlocking True if producers and consumers block on a full and an empty queue.
+     * @return A new queue resource, or NULLPTR if an error has been occurred.
+     */
+    MpmcQueue<QueueManager, EOOS_GLOBAL_SYS_QUEUE_LENGTH>* createMpmc(bool_t isBlocking);
+
+    /**
+     * @brief Returns statistics of the resource memory pool.
+     *
+     * @param statistics Statistics the pool statistics are copied to.
+     * @return True if the statistics are got.
+     */
+    bool_t getStatistics(ResourceStatistics& statistics) const;
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees allocated memory.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);        
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes the allocator with heap for resource allocation.
+     *
+     * @param resource Heap for resource allocation.
+     * @return True if initialized.
+     */
+    static bool_t initialize(api::Heap* resource);
+
+    /**
+     * @brief Initializes the allocator.
+     */
+    static void deinitialize();
+    
+    /**
+     * @struct ResourcePool
+     * @brief Resource memory pool.
+     */
+    struct ResourcePool
+    {
+
+    public:
+        
+        /**
+         * @brief Constructor.
+         */        
+        ResourcePool();
+
+        /**
+         * @brief Queue memory allocator.
+         */     
+        ResourceMemory<Slot, EOOS_GLOBAL_SYS_NUMBER_OF_QUEUES> memory;
+
+    };
+
+    /**
+     * @brief Heap for resource allocation.
+     */
+    static api::Heap* resource_;
+        
+    /**
+     * @brief Resource memory pool.
+     */
+    ResourcePool pool_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_QUEUEMANAGER_HPP_
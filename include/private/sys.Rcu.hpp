@@ -0,0 +1,240 @@
+/**
+ * @file      sys.Rcu.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RCU_HPP_
+#define SYS_RCU_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Heap.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Rcu
+ * @brief Read-copy-update synchronization of read-mostly data.
+ *
+ * Readers mark their read-side critical sections in per-thread records, and a writer publishes
+ * a new copy of data and waits for a grace period, after which no reader can refer to the old copy.
+ * A grace period advances an epoch and waits until each reader has left a section it entered
+ * in a previous epoch.
+ *
+ * The read-side marking makes no atomic read-modify-write operations. If the kernel supports
+ * expedited membarrier system call, the writer makes memory barriers on behalf of the readers,
+ * and the readers make compiler barriers only. Otherwise, the readers make memory fences.
+ *
+ * @note A thread shall not wait for a grace period in a read-side critical section.
+ */
+class Rcu : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param heap The heap retired memory is freed to.
+     */
+    explicit Rcu(api::Heap& heap);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Rcu();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Enters a read-side critical section.
+     *
+     * @note The sections can be nested.
+     *
+     * @return True if the section has been entered.
+     */
+    bool_t lock();
+
+    /**
+     * @brief Leaves a read-side critical section.
+     */
+    void unlock();
+
+    /**
+     * @brief Waits for a grace period.
+     *
+     * @return True if all read-side critical sections entered before the call have been left.
+     */
+    bool_t synchronize();
+
+    /**
+     * @brief Frees memory after a grace period.
+     *
+     * Retired memory is collected and freed in batches, so a grace period is waited for once per batch.
+     *
+     * @note The memory shall be allocated in the heap and be unreachable for new readers.
+     *
+     * @param ptr Address of retired memory.
+     * @return True if the memory will be freed.
+     */
+    bool_t retire(void* ptr);
+
+    /**
+     * @brief Frees all retired memory after a grace period.
+     *
+     * @return True if the memory has been freed.
+     */
+    bool_t reclaim();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Number of retired memory blocks which are freed at once.
+     */
+    static const int32_t RETIRE_LIMIT = 64;
+
+    /**
+     * @struct Record
+     * @brief Read-side record of a thread.
+     */
+    struct Record
+    {
+        /**
+         * @brief Epoch the thread has entered a read-side critical section in, or zero if it is out of sections.
+         */
+        uint32_t epoch; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Nesting level of read-side critical sections.
+         */
+        int32_t nesting; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Non-zero if the record is used by a thread.
+         */
+        int32_t isUsed; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Next record.
+         */
+        Record* next; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Padding of the record to a cache line, so threads do not share records cache lines.
+         */
+        uint8_t padding[EOOS_GLOBAL_SYS_CACHE_LINE_SIZE]; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Deinitializes this object.
+     */
+    void deinitialize();
+
+    /**
+     * @brief Returns the record of the caller thread.
+     *
+     * @return The record, or NULLPTR if an error occurred.
+     */
+    Record* getRecord();
+
+    /**
+     * @brief Waits for a grace period.
+     *
+     * @note The writer mutex shall be locked.
+     */
+    void wait();
+
+    /**
+     * @brief Frees retired memory after a grace period.
+     *
+     * @note The writer mutex shall be locked.
+     */
+    void free();
+
+    /**
+     * @brief Makes a read-side barrier.
+     */
+    void barrier() const;
+
+    /**
+     * @brief Makes a memory barrier on all threads of the process.
+     */
+    void synchronizeCpus() const;
+
+    /**
+     * @brief Releases a record of a thread which exits.
+     *
+     * @param record The record.
+     */
+    static void release(void* record);
+
+    /**
+     * @brief Tests if the expedited membarrier system call is available.
+     *
+     * @return True if the call is registered and works.
+     */
+    static bool_t isMembarrier();
+
+    /**
+     * @brief The heap.
+     */
+    api::Heap& heap_;
+
+    /**
+     * @brief Current epoch, which is never zero.
+     */
+    uint32_t epoch_;
+
+    /**
+     * @brief Records of threads, which are pushed without locks and are freed on destruction only.
+     */
+    Record* records_;
+
+    /**
+     * @brief Retired memory to be freed, which is not written until it is freed as readers might read it.
+     */
+    void* retired_[RETIRE_LIMIT];
+
+    /**
+     * @brief Number of retired memory blocks.
+     */
+    int32_t retiredCount_;
+
+    /**
+     * @brief Expedited membarrier flag.
+     */
+    bool_t isExpedited_;
+
+    /**
+     * @brief Key of the thread records.
+     */
+    ::pthread_key_t key_;
+
+    /**
+     * @brief Mutex of writers.
+     */
+    ::pthread_mutex_t mutex_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RCU_HPP_
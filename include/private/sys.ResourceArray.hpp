@@ -0,0 +1,269 @@
+/**
+ * @file      sys.ResourceArray.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RESOURCEARRAY_HPP_
+#define SYS_RESOURCEARRAY_HPP_
+
+#include "sys.NonCopyable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ResourceArray
+ * @brief Array of resources placed in one memory block.
+ *
+ * The array is created at the start of one block allocated at once, and the resources are created
+ * in one pass in cells of the block which follow the array. Each cell is padded to a cache line,
+ * so neighbour resources do not share a cache line. The resources are destroyed and the block
+ * is freed when the array is deleted.
+ *
+ * @note Alignment of the resource type shall not exceed the cache line size.
+ *
+ * @tparam T Resource type.
+ * @tparam A Heap memory allocator class.
+ */
+template <class T, class A>
+class ResourceArray : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Creates a new array of resources constructed without arguments.
+     *
+     * @param length Number of resources.
+     * @return A new array which shall be tested for construction, or NULLPTR if memory is not allocated.
+     */
+    static ResourceArray* create(int32_t length);
+
+    /**
+     * @brief Creates a new array of resources constructed with an argument.
+     *
+     * @param length   Number of resources.
+     * @param argument Argument of each resource constructor.
+     * @return A new array which shall be tested for construction, or NULLPTR if memory is not allocated.
+     */
+    static ResourceArray* create(int32_t length, int32_t argument);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ResourceArray();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Returns number of resources.
+     *
+     * @return Number of resources.
+     */
+    int32_t getLength() const;
+
+    /**
+     * @brief Returns a resource.
+     *
+     * @param index Index of a resource.
+     * @return The resource, or NULLPTR if the index is out of the array.
+     */
+    T* get(int32_t index) const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Size of one cell in bytes, which is a multiple of cache line size.
+     */
+    static const size_t CELL_SIZE = ( (sizeof(T) + EOOS_GLOBAL_SYS_CACHE_LINE_SIZE - 1U) / EOOS_GLOBAL_SYS_CACHE_LINE_SIZE ) * EOOS_GLOBAL_SYS_CACHE_LINE_SIZE;
+
+    /**
+     * @brief Compile error if the resource alignment exceeds the cache line size, as cells are aligned to a cache line.
+     */
+    typedef char_t IsAligned[ ( __alignof__(T) <= EOOS_GLOBAL_SYS_CACHE_LINE_SIZE ) ? 1 : -1 ];
+
+    /**
+     * @brief Constructor of resources constructed without arguments.
+     *
+     * @param length Number of resources.
+     */
+    explicit ResourceArray(int32_t length);
+
+    /**
+     * @brief Constructor of resources constructed with an argument.
+     *
+     * @param length   Number of resources.
+     * @param argument Argument of each resource constructor.
+     */
+    ResourceArray(int32_t length, int32_t argument);
+
+    /**
+     * @brief Allocates a memory block of an array and its resources.
+     *
+     * @param length Number of resources.
+     * @return The memory block, or NULLPTR if an error occurred.
+     */
+    static void* allocate(int32_t length);
+
+    /**
+     * @brief Returns memory of the cells of an array.
+     *
+     * @param array An array at the start of its memory block.
+     * @return Memory of the first cell, which is the first cache line after the array.
+     */
+    static uint8_t* getCells(ResourceArray const* array);
+
+    /**
+     * @brief Returns memory of a cell.
+     *
+     * @param index Index of a cell.
+     * @return The cell memory.
+     */
+    void* getCell(int32_t index) const;
+
+    /**
+     * @brief Number of resources.
+     */
+    int32_t length_;
+
+    /**
+     * @brief Number of created resources.
+     */
+    int32_t created_;
+
+    /**
+     * @brief Cache line aligned memory of the cells which follows this array in the block.
+     */
+    uint8_t* cells_;
+
+};
+
+template <class T, class A>
+ResourceArray<T,A>* ResourceArray<T,A>::create(int32_t const length)
+{
+    ResourceArray* array( NULLPTR );
+    void* const block( allocate(length) );
+    if( block != NULLPTR )
+    {
+        // The array is deleted as any object, and its allocator frees the block at the array address
+        array = new (block) ResourceArray(length);
+    }
+    return array;
+}
+
+template <class T, class A>
+ResourceArray<T,A>* ResourceArray<T,A>::create(int32_t const length, int32_t const argument)
+{
+    ResourceArray* array( NULLPTR );
+    void* const block( allocate(length) );
+    if( block != NULLPTR )
+    {
+        array = new (block) ResourceArray(length, argument);
+    }
+    return array;
+}
+
+template <class T, class A>
+ResourceArray<T,A>::ResourceArray(int32_t const length)
+    : NonCopyable<A>()
+    , length_(length)
+    , created_(0)
+    , cells_( getCells(this) ) {
+    bool_t isConstructed( Parent::isConstructed() );
+    while( isConstructed && (created_ < length_) )
+    {
+        T* const resource( new (getCell(created_)) T() );
+        ++created_;
+        isConstructed = resource->isConstructed();
+    }
+    setConstructed( isConstructed );
+}
+
+template <class T, class A>
+ResourceArray<T,A>::ResourceArray(int32_t const length, int32_t const argument)
+    : NonCopyable<A>()
+    , length_(length)
+    , created_(0)
+    , cells_( getCells(this) ) {
+    bool_t isConstructed( Parent::isConstructed() );
+    while( isConstructed && (created_ < length_) )
+    {
+        T* const resource( new (getCell(created_)) T(argument) );
+        ++created_;
+        isConstructed = resource->isConstructed();
+    }
+    setConstructed( isConstructed );
+}
+
+template <class T, class A>
+ResourceArray<T,A>::~ResourceArray()
+{
+    while( created_ > 0 )
+    {
+        --created_;
+        static_cast<T*>( getCell(created_) )->~T();
+    }
+}
+
+template <class T, class A>
+bool_t ResourceArray<T,A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class T, class A>
+int32_t ResourceArray<T,A>::getLength() const
+{
+    return length_;
+}
+
+template <class T, class A>
+T* ResourceArray<T,A>::get(int32_t const index) const
+{
+    T* resource( NULLPTR );
+    if( isConstructed() && (index >= 0) && (index < length_) )
+    {
+        resource = static_cast<T*>( getCell(index) );
+    }
+    return resource;
+}
+
+template <class T, class A>
+void* ResourceArray<T,A>::allocate(int32_t const length)
+{
+    void* block( NULLPTR );
+    // The cells follow the array, and one more cache line is allocated to align the cells to a cache line
+    size_t const extra( sizeof(ResourceArray) + EOOS_GLOBAL_SYS_CACHE_LINE_SIZE );
+    if( (length > 0) && ( static_cast<size_t>(length) <= ( (~static_cast<size_t>(0U)) - extra ) / CELL_SIZE ) )
+    {
+        block = A::allocate( static_cast<size_t>(length) * CELL_SIZE + extra );
+    }
+    return block;
+}
+
+template <class T, class A>
+uint8_t* ResourceArray<T,A>::getCells(ResourceArray const* const array)
+{
+    uintptr_t const addr( reinterpret_cast<uintptr_t>(array) + sizeof(ResourceArray) );
+    return reinterpret_cast<uint8_t*>( ( (addr + EOOS_GLOBAL_SYS_CACHE_LINE_SIZE - 1U) / EOOS_GLOBAL_SYS_CACHE_LINE_SIZE ) * EOOS_GLOBAL_SYS_CACHE_LINE_SIZE ); ///< SCA MISRA-C++:2008 Justified Rule 5-2-8
+}
+
+template <class T, class A>
+void* ResourceArray<T,A>::getCell(int32_t const index) const
+{
+    return &cells_[static_cast<size_t>(index) * CELL_SIZE];
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RESOURCEARRAY_HPP_
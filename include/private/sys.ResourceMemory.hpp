@@ -0,0 +1,679 @@
+/**
+ * @file      sys.ResourceMemory.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RESOURCEMEMORY_HPP_
+#define SYS_RESOURCEMEMORY_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Heap.hpp"
+#include "sys.Heap.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @struct ResourceSlot
+ * @brief Memory of a pool slot which fits any of two resource types.
+ *
+ * @note Slots can be nested to fit more types, for example ResourceSlot<T1, ResourceSlot<T2,T3> >.
+ *
+ * @tparam T1 Resource type.
+ * @tparam T2 Resource type.
+ */
+template <class T1, class T2>
+struct ResourceSlot
+{
+    /**
+     * @brief Size of the largest resource type.
+     */
+    static const size_t SIZE = ( sizeof(T1) > sizeof(T2) ) ? sizeof(T1) : sizeof(T2);
+
+    /**
+     * @brief Alignment of the strictest aligned resource type.
+     */
+    static const size_t ALIGNMENT = ( __alignof__(T1) > __alignof__(T2) ) ? __alignof__(T1) : __alignof__(T2);
+
+    /**
+     * @brief Memory of the slot.
+     */
+    uint64_t memory[ (SIZE + sizeof(uint64_t) - 1U) / sizeof(uint64_t) ] __attribute__((aligned(ALIGNMENT))); ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+};
+
+/**
+ * @struct ResourceStorage
+ * @brief Caller provided memory a resource can be created in.
+ *
+ * @tparam T Resource type.
+ */
+template <class T>
+struct ResourceStorage
+{
+    /**
+     * @brief Memory of the resource.
+     */
+    uint64_t memory[ (sizeof(T) + sizeof(uint64_t) - 1U) / sizeof(uint64_t) ] __attribute__((aligned(__alignof__(T)))); ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+};
+
+/**
+ * @struct ResourceStatistics
+ * @brief Statistics of a resource memory pool.
+ */
+struct ResourceStatistics
+{
+    /**
+     * @brief Number of slots of the static chunk and the mapped region.
+     */
+    int32_t capacity;
+
+    /**
+     * @brief Number of slots put into use, which are committed in chunks up to the capacity.
+     */
+    int32_t committed;
+
+    /**
+     * @brief Number of allocated slots.
+     */
+    int32_t used;
+
+    /**
+     * @brief Number of resources allocated in heap memory as no slots were free.
+     */
+    int32_t fallbacks;
+
+};
+
+/**
+ * @class ResourceMemory
+ * @brief Bounded lazily committed lock-free resource memory pool.
+ *
+ * Slots are allocated first in a static chunk of N slots, next in a memory region of a capacity given
+ * at startup by an environment variable, and then in heap memory. The pool does not grow beyond
+ * the capacity: the region is mapped once with no more than MAXIMUM_CAPACITY slots, and only
+ * its pages are committed lazily as its slots are put into use in chunks of CHUNK_SIZE slots,
+ * so pages of unused slots are not touched.
+ *
+ * Free slots are kept in a Treiber stack which head contains a slot index and a modification tag
+ * incremented on each change, so a stale head cannot be exchanged after its slot was popped and pushed back.
+ *
+ * @tparam T Resource type, or resource slot type of several resource types.
+ * @tparam N Number of resources of the static chunk.
+ */
+template <class T, int32_t N>
+class ResourceMemory : public NonCopyable<NoAllocator>, public api::Heap
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param variable Name of an environment variable of the number of resources of the memory region.
+     */
+    explicit ResourceMemory(char_t const* variable);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ResourceMemory();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Heap::allocate(size_t,void*)
+     */
+    virtual void* allocate(size_t size, void* ptr);
+
+    /**
+     * @copydoc eoos::api::Heap::free(void*)
+     */
+    virtual void free(void* ptr);
+
+    /**
+     * @brief Returns statistics of the pool.
+     *
+     * @param statistics Statistics the pool statistics are copied to.
+     * @return True if the statistics are got.
+     */
+    bool_t getStatistics(ResourceStatistics& statistics) const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Index of no slot.
+     */
+    static const uint32_t NO_INDEX = 0xFFFFFFFFU;
+
+    /**
+     * @brief Number of region slots put into use at once.
+     */
+    static const uint32_t CHUNK_SIZE = 64U;
+
+    /**
+     * @brief Maximum number of region slots.
+     */
+    static const uint32_t MAXIMUM_CAPACITY = 0x100000U;
+
+    #ifdef EOOS_GLOBAL_SYS_RESOURCE_PADDING
+
+    /**
+     * @brief Size of one slot in bytes padded to the cache line size.
+     */
+    static const size_t SLOT_SIZE = ( (sizeof(T) + EOOS_GLOBAL_SYS_CACHE_LINE_SIZE - 1U) / EOOS_GLOBAL_SYS_CACHE_LINE_SIZE ) * EOOS_GLOBAL_SYS_CACHE_LINE_SIZE;
+
+    /**
+     * @brief Alignment of slots which is not less than the cache line size.
+     */
+    static const size_t SLOT_ALIGNMENT = ( __alignof__(T) > EOOS_GLOBAL_SYS_CACHE_LINE_SIZE ) ? __alignof__(T) : EOOS_GLOBAL_SYS_CACHE_LINE_SIZE;
+
+    #else
+
+    /**
+     * @brief Size of one slot in bytes.
+     */
+    static const size_t SLOT_SIZE = sizeof(T);
+
+    /**
+     * @brief Alignment of slots.
+     */
+    static const size_t SLOT_ALIGNMENT = __alignof__(T);
+
+    #endif // EOOS_GLOBAL_SYS_RESOURCE_PADDING
+
+    /**
+     * @brief Number of static slots which arrays are declared with.
+     */
+    static const size_t STATIC_SLOTS = ( N > 0 ) ? static_cast<size_t>(N) : 1U;
+
+    /**
+     * @brief Number of memory cells for all static slots.
+     */
+    static const size_t MEMORY_CELLS = ( STATIC_SLOTS * SLOT_SIZE + sizeof(uint64_t) - 1U ) / sizeof(uint64_t);
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param variable Name of an environment variable of the number of resources of the memory region.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(char_t const* variable);
+
+    /**
+     * @brief Maps the memory region.
+     *
+     * @param capacity Number of region slots.
+     * @return True if the region is mapped.
+     */
+    bool_t initialize(uint32_t capacity);
+
+    /**
+     * @brief Unmaps the memory region if no slots are used.
+     */
+    void deinitialize();
+
+    /**
+     * @brief Pops a free slot.
+     *
+     * @return A slot index, or NO_INDEX if no free slots.
+     */
+    uint32_t pop();
+
+    /**
+     * @brief Pushes a free slot.
+     *
+     * @param index A slot index.
+     */
+    void push(uint32_t index);
+
+    /**
+     * @brief Puts a chunk of region slots into use.
+     *
+     * @return A slot index of the chunk for the caller, or NO_INDEX if all region slots are in use.
+     */
+    uint32_t commit();
+
+    /**
+     * @brief Returns slot index of an address.
+     *
+     * @param ptr An address.
+     * @return A slot index, or NO_INDEX if the address is not a slot address.
+     */
+    uint32_t getIndex(void const* ptr) const;
+
+    /**
+     * @brief Tests if an address is inside the static slots or the region slots.
+     *
+     * @param ptr An address.
+     * @return True if the address is inside the slots.
+     */
+    bool_t isInside(void const* ptr) const;
+
+    /**
+     * @brief Returns next free slot index cell of a slot.
+     *
+     * @param index A slot index.
+     * @return The cell.
+     */
+    uint32_t* getNext(uint32_t index);
+
+    /**
+     * @brief Returns address of a slot.
+     *
+     * @param index A slot index.
+     * @return The address.
+     */
+    void* getSlot(uint32_t index);
+
+    /**
+     * @brief Makes head of the free slot stack.
+     *
+     * @param tag   A modification tag.
+     * @param index A slot index.
+     * @return The head.
+     */
+    static uint64_t makeHead(uint32_t tag, uint32_t index);
+
+    /**
+     * @brief Returns number of region slots set by an environment variable.
+     *
+     * @param variable Name of an environment variable.
+     * @return The number of slots limited to MAXIMUM_CAPACITY, or zero if the variable is not set or not valid.
+     */
+    static uint32_t getCapacity(char_t const* variable);
+
+    /**
+     * @brief Head of the free slot stack.
+     */
+    uint64_t head_;
+
+    /**
+     * @brief Number of region slots.
+     */
+    uint32_t capacity_;
+
+    /**
+     * @brief Number of region slots put into use.
+     */
+    uint32_t committed_;
+
+    /**
+     * @brief Number of allocated slots.
+     */
+    int32_t used_;
+
+    /**
+     * @brief Number of resources allocated in heap memory.
+     */
+    int32_t fallbacks_;
+
+    /**
+     * @brief Mapped memory region.
+     */
+    void* region_;
+
+    /**
+     * @brief Size of the mapped memory region in bytes.
+     */
+    size_t regionSize_;
+
+    /**
+     * @brief Next free slot indexes of the region slots.
+     */
+    uint32_t* regionNext_;
+
+    /**
+     * @brief Memory of the region slots.
+     */
+    uint8_t* regionMemory_;
+
+    /**
+     * @brief Next free slot indexes of the static slots.
+     */
+    uint32_t next_[STATIC_SLOTS];
+
+    /**
+     * @brief Memory of the static slots.
+     */
+    uint64_t memory_[MEMORY_CELLS] __attribute__((aligned(SLOT_ALIGNMENT)));
+
+    /**
+     * @brief The system heap.
+     */
+    sys::Heap heap_;
+
+};
+
+template <class T, int32_t N>
+ResourceMemory<T,N>::ResourceMemory(char_t const* const variable)
+    : NonCopyable<NoAllocator>()
+    , api::Heap()
+    , head_( makeHead(0U, NO_INDEX) )
+    , capacity_(0U)
+    , committed_(0U)
+    , used_(0)
+    , fallbacks_(0)
+    , region_(NULLPTR)
+    , regionSize_(0U)
+    , regionNext_(NULLPTR)
+    , regionMemory_(NULLPTR)
+    , next_()
+    , memory_()
+    , heap_() {
+    bool_t const isConstructed( construct(variable) );
+    setConstructed( isConstructed );
+}
+
+template <class T, int32_t N>
+ResourceMemory<T,N>::~ResourceMemory()
+{
+    deinitialize();
+}
+
+template <class T, int32_t N>
+bool_t ResourceMemory<T,N>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class T, int32_t N>
+void* ResourceMemory<T,N>::allocate(size_t const size, void* ptr)
+{
+    void* addr( NULLPTR );
+    if( isConstructed() )
+    {
+        if( size <= SLOT_SIZE )
+        {
+            uint32_t index( pop() );
+            if( index == NO_INDEX )
+            {
+                index = commit();
+            }
+            if( index != NO_INDEX )
+            {
+                static_cast<void>( __atomic_add_fetch(&used_, 1, __ATOMIC_RELAXED) );
+                addr = getSlot(index);
+            }
+        }
+        if( addr == NULLPTR )
+        {
+            addr = heap_.allocate(size, ptr);
+            if( addr != NULLPTR )
+            {
+                static_cast<void>( __atomic_add_fetch(&fallbacks_, 1, __ATOMIC_RELAXED) );
+            }
+        }
+    }
+    return addr;
+}
+
+template <class T, int32_t N>
+void ResourceMemory<T,N>::free(void* ptr)
+{
+    if( isConstructed() )
+    {
+        uint32_t const index( getIndex(ptr) );
+        if( index != NO_INDEX )
+        {
+            push(index);
+            static_cast<void>( __atomic_sub_fetch(&used_, 1, __ATOMIC_RELAXED) );
+        }
+        else if( !isInside(ptr) )
+        {
+            heap_.free(ptr);
+        }
+        else
+        {
+            // The address is inside the slots but not a slot address, and it is not freed
+        }
+    }
+}
+
+template <class T, int32_t N>
+bool_t ResourceMemory<T,N>::getStatistics(ResourceStatistics& statistics) const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        uint32_t const committed( __atomic_load_n(&committed_, __ATOMIC_RELAXED) );
+        statistics.capacity = N + static_cast<int32_t>(capacity_);
+        statistics.committed = N + static_cast<int32_t>(committed);
+        statistics.used = __atomic_load_n(&used_, __ATOMIC_RELAXED);
+        statistics.fallbacks = __atomic_load_n(&fallbacks_, __ATOMIC_RELAXED);
+        res = true;
+    }
+    return res;
+}
+
+template <class T, int32_t N>
+bool_t ResourceMemory<T,N>::construct(char_t const* const variable)
+{
+    bool_t res( false );
+    if( isConstructed() && heap_.isConstructed() )
+    {
+        for(uint32_t i(static_cast<uint32_t>(N)); i > 0U; --i)
+        {
+            push(i - 1U);
+        }
+        res = initialize( getCapacity(variable) );
+    }
+    return res;
+}
+
+template <class T, int32_t N>
+bool_t ResourceMemory<T,N>::initialize(uint32_t const capacity)
+{
+    bool_t res( true );
+    if( capacity > 0U )
+    {
+        size_t const alignment( ( SLOT_ALIGNMENT > EOOS_GLOBAL_SYS_CACHE_LINE_SIZE ) ? SLOT_ALIGNMENT : EOOS_GLOBAL_SYS_CACHE_LINE_SIZE );
+        size_t const nextSize( ( (static_cast<size_t>(capacity) * sizeof(uint32_t) + alignment - 1U) / alignment ) * alignment );
+        size_t const size( nextSize + static_cast<size_t>(capacity) * SLOT_SIZE );
+        // The region is reserved without swap space, and pages are allocated as slots are put into use
+        void* const addr( ::mmap(NULLPTR, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0) );
+        if( addr != MAP_FAILED )
+        {
+            region_ = addr;
+            regionSize_ = size;
+            regionNext_ = static_cast<uint32_t*>(addr);
+            regionMemory_ = &static_cast<uint8_t*>(addr)[nextSize];
+            capacity_ = capacity;
+        }
+        else
+        {
+            res = false;
+        }
+    }
+    return res;
+}
+
+template <class T, int32_t N>
+void ResourceMemory<T,N>::deinitialize()
+{
+    // The region is left mapped if resources are still in use, as a detached thread might still refer to its resource
+    if( (region_ != NULLPTR) && (__atomic_load_n(&used_, __ATOMIC_ACQUIRE) == 0) )
+    {
+        static_cast<void>( ::munmap(region_, regionSize_) );
+        region_ = NULLPTR;
+    }
+}
+
+template <class T, int32_t N>
+uint32_t ResourceMemory<T,N>::pop()
+{
+    uint32_t index( NO_INDEX );
+    bool_t isPopped( false );
+    uint64_t head( __atomic_load_n(&head_, __ATOMIC_ACQUIRE) );
+    do
+    {
+        index = static_cast<uint32_t>(head);
+        if( index == NO_INDEX )
+        {
+            break;
+        }
+        // The next index might be stale if the slot has been popped concurrently,
+        // but then the head tag has been changed and the exchange fails.
+        uint32_t const next( __atomic_load_n(getNext(index), __ATOMIC_RELAXED) );
+        uint32_t const tag( static_cast<uint32_t>(head >> 32) + 1U );
+        isPopped = __atomic_compare_exchange_n(&head_, &head, makeHead(tag, next), false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE);
+    }
+    while( !isPopped );
+    return index;
+}
+
+template <class T, int32_t N>
+void ResourceMemory<T,N>::push(uint32_t const index)
+{
+    bool_t isPushed( false );
+    uint32_t* const next( getNext(index) );
+    uint64_t head( __atomic_load_n(&head_, __ATOMIC_RELAXED) );
+    do
+    {
+        __atomic_store_n(next, static_cast<uint32_t>(head), __ATOMIC_RELAXED);
+        uint32_t const tag( static_cast<uint32_t>(head >> 32) + 1U );
+        isPushed = __atomic_compare_exchange_n(&head_, &head, makeHead(tag, index), false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    }
+    while( !isPushed );
+}
+
+template <class T, int32_t N>
+uint32_t ResourceMemory<T,N>::commit()
+{
+    uint32_t index( NO_INDEX );
+    uint32_t committed( __atomic_load_n(&committed_, __ATOMIC_RELAXED) );
+    while( committed < capacity_ )
+    {
+        uint32_t const end( ( (capacity_ - committed) > CHUNK_SIZE ) ? (committed + CHUNK_SIZE) : capacity_ );
+        if( __atomic_compare_exchange_n(&committed_, &committed, end, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED) )
+        {
+            uint32_t const first( static_cast<uint32_t>(N) + committed );
+            for(uint32_t i( static_cast<uint32_t>(N) + end - 1U ); i > first; --i)
+            {
+                push(i);
+            }
+            index = first;
+            break;
+        }
+    }
+    return index;
+}
+
+template <class T, int32_t N>
+uint32_t ResourceMemory<T,N>::getIndex(void const* const ptr) const
+{
+    uint32_t index( NO_INDEX );
+    uintptr_t const addr( reinterpret_cast<uintptr_t>(ptr) );
+    uintptr_t const begin( reinterpret_cast<uintptr_t>(memory_) );
+    uintptr_t const regionBegin( reinterpret_cast<uintptr_t>(regionMemory_) );
+    if( (N > 0) && (addr >= begin) && ( (addr - begin) < (static_cast<uintptr_t>(N) * SLOT_SIZE) ) )
+    {
+        uintptr_t const offset( addr - begin );
+        if( (offset % SLOT_SIZE) == 0U )
+        {
+            index = static_cast<uint32_t>(offset / SLOT_SIZE);
+        }
+    }
+    else if( (capacity_ > 0U) && (addr >= regionBegin) && ( (addr - regionBegin) < (static_cast<uintptr_t>(capacity_) * SLOT_SIZE) ) )
+    {
+        uintptr_t const offset( addr - regionBegin );
+        if( (offset % SLOT_SIZE) == 0U )
+        {
+            index = static_cast<uint32_t>(N) + static_cast<uint32_t>(offset / SLOT_SIZE);
+        }
+    }
+    else
+    {
+        // The address is not a slot address
+    }
+    return index;
+}
+
+template <class T, int32_t N>
+bool_t ResourceMemory<T,N>::isInside(void const* const ptr) const
+{
+    uintptr_t const addr( reinterpret_cast<uintptr_t>(ptr) );
+    uintptr_t const begin( reinterpret_cast<uintptr_t>(memory_) );
+    uintptr_t const regionBegin( reinterpret_cast<uintptr_t>(regionMemory_) );
+    bool_t const isStatic( (N > 0) && (addr >= begin) && ( (addr - begin) < (static_cast<uintptr_t>(N) * SLOT_SIZE) ) );
+    bool_t const isRegion( (capacity_ > 0U) && (addr >= regionBegin) && ( (addr - regionBegin) < (static_cast<uintptr_t>(capacity_) * SLOT_SIZE) ) );
+    return isStatic || isRegion;
+}
+
+template <class T, int32_t N>
+uint32_t* ResourceMemory<T,N>::getNext(uint32_t const index)
+{
+    uint32_t* next( NULLPTR );
+    if( index < static_cast<uint32_t>(N) )
+    {
+        next = &next_[index];
+    }
+    else
+    {
+        next = &regionNext_[index - static_cast<uint32_t>(N)];
+    }
+    return next;
+}
+
+template <class T, int32_t N>
+void* ResourceMemory<T,N>::getSlot(uint32_t const index)
+{
+    uint8_t* slot( NULLPTR );
+    if( index < static_cast<uint32_t>(N) )
+    {
+        slot = &reinterpret_cast<uint8_t*>(memory_)[static_cast<size_t>(index) * SLOT_SIZE];
+    }
+    else
+    {
+        slot = &regionMemory_[static_cast<size_t>(index - static_cast<uint32_t>(N)) * SLOT_SIZE];
+    }
+    return slot;
+}
+
+template <class T, int32_t N>
+uint64_t ResourceMemory<T,N>::makeHead(uint32_t const tag, uint32_t const index)
+{
+    return ( static_cast<uint64_t>(tag) << 32 ) | static_cast<uint64_t>(index);
+}
+
+template <class T, int32_t N>
+uint32_t ResourceMemory<T,N>::getCapacity(char_t const* const variable)
+{
+    uint32_t capacity( 0U );
+    if( variable != NULLPTR )
+    {
+        char_t const* const value( ::getenv(variable) );
+        if( value != NULLPTR )
+        {
+            char_t* end( NULLPTR );
+            long const number( ::strtol(value, &end, 10) ); ///< SCA MISRA-C++:2008 Justified Rule 3-9-2
+            if( (end != value) && (*end == '\0') && (number > 0L) ) ///< SCA MISRA-C++:2008 Justified Rule 3-9-2
+            {
+                if( number > static_cast<long>(MAXIMUM_CAPACITY) ) ///< SCA MISRA-C++:2008 Justified Rule 3-9-2
+                {
+                    capacity = MAXIMUM_CAPACITY;
+                }
+                else
+                {
+                    capacity = static_cast<uint32_t>(number);
+                }
+            }
+        }
+    }
+    return capacity;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RESOURCEMEMORY_HPP_
@@ -9,8 +9,8 @@
 #include "sys.NonCopyable.hpp"
 #include "api.Scheduler.hpp"
 #include "sys.Thread.hpp"
-#include "sys.Mutex.hpp"
-#include "lib.ResourceMemory.hpp"
+#include "sys.ResourceMemory.hpp"
+#include "sys.ThreadRegistry.hpp"
 
 namespace eoos
 {
@@ -28,6 +28,11 @@ class Scheduler : public NonCopyable<NoAllocator>, public api::Scheduler
 
 public:
 
+    /**
+     * @brief Caller provided memory a thread can be created in.
+     */
+    typedef ResourceStorage<Resource> Storage;
+
     /**
      * @brief Constructor.
      */
@@ -47,6 +52,50 @@ public:
      * @copydoc eoos::api::Scheduler::createThread(api::Task&)
      */     
     virtual api::Thread* createThread(api::Task& task);
+
+    /**
+     * @brief Creates a new thread resource in caller provided memory.
+     *
+     * @note The resource shall be destroyed by destroyThread() before the memory is released or reused.
+     *
+     * @param storage Memory the thread is created in.
+     * @param task    An user task which main method will be invoked when created thread is started.
+     * @return A new thread resource, or NULLPTR if an error has been occurred.
+     */
+    api::Thread* createThread(Storage& storage, api::Task& task);
+
+    /**
+     * @brief Creates a new thread resource which calls a function.
+     *
+     * @param function  A function which is called when created thread is started.
+     * @param stackSize Stack size of the thread, or zero for the default size.
+     * @return A new thread resource, or NULLPTR if an error has been occurred.
+     */
+    api::Thread* createThread(void (*function)(), size_t stackSize);
+
+    /**
+     * @brief Creates a new thread resource which calls a callable object kept in the resource.
+     *
+     * The callable object with its captured state is copied into the control block of the thread resource,
+     * so no memory is allocated but the resource.
+     *
+     * @param function  A callable object which is called without arguments when created thread is started.
+     * @param stackSize Stack size of the thread, or zero for the default size.
+     * @return A new thread resource, or NULLPTR if an error has been occurred.
+     * @tparam F Type of the callable object, which size shall not exceed EOOS_GLOBAL_SYS_CALLABLE_CAPACITY.
+     */
+    template <class F>
+    api::Thread* createThread(F const& function, size_t stackSize);
+
+    /**
+     * @brief Destroys a thread resource created in caller provided memory.
+     *
+     * The cancellation of the thread is requested, and its task is waited to return without a time limit,
+     * as the caller memory cannot be kept for a thread which has not returned.
+     *
+     * @param storage Memory a thread resource has been created in by createThread(Storage&,api::Task&) which did not return NULLPTR.
+     */
+    void destroyThread(Storage& storage);
     
     /**
      * @copydoc eoos::api::Scheduler::sleep(int32_t)
@@ -58,6 +107,33 @@ public:
      */
     virtual bool_t yield();
 
+    /**
+     * @brief Stops all running threads created by this scheduler.
+     *
+     * The cancellation of the threads is requested, and their tasks are waited to return.
+     *
+     * @param ms A time to wait in milliseconds.
+     * @return True if all the threads have returned in time.
+     */
+    bool_t stop(int32_t ms);
+
+    /**
+     * @brief Takes a snapshot of statistics of the live threads created by this scheduler.
+     *
+     * @param statistics An array the statistics are copied to.
+     * @param length     Number of elements of the array.
+     * @return Number of the live threads, which might exceed the array length, or -1 if an error occurred.
+     */
+    int32_t getThreadStatistics(ThreadStatistics* statistics, int32_t length);
+
+    /**
+     * @brief Returns statistics of the resource memory pool.
+     *
+     * @param statistics Statistics the pool statistics are copied to.
+     * @return True if the statistics are got.
+     */
+    bool_t getStatistics(ResourceStatistics& statistics) const;
+
     /**
      * @brief Allocates memory.
      *
@@ -86,6 +162,14 @@ private:
      */
     bool_t construct();
 
+    /**
+     * @brief Checks a new thread resource.
+     *
+     * @param resource A new thread resource, or NULLPTR.
+     * @return The thread resource, or NULLPTR if it is not constructed and has been deleted.
+     */
+    api::Thread* check(Resource* resource);
+
     /**
      * @brief Sets child thread's CPU affinity mask to primary thread CPU.
      * 
@@ -127,7 +211,7 @@ private:
      * @brief Initializes the allocator.
      */
     void deinitialize();
-    
+
     /**
      * @struct ResourcePool
      * @brief Resource memory pool.
@@ -142,19 +226,10 @@ private:
          */
         ResourcePool();
 
-    private:
-            
-        /**
-         * @brief Mutex resource.
-         */    
-        Mutex<NoAllocator> mutex_;
-        
-    public:
-        
         /**
          * @brief Resource memory allocator.
          */     
-        lib::ResourceMemory<Resource, EOOS_GLOBAL_SYS_NUMBER_OF_THREADS> memory;
+        ResourceMemory<Resource, EOOS_GLOBAL_SYS_NUMBER_OF_THREADS> memory;
 
     };
 
@@ -168,8 +243,24 @@ private:
      */
     ResourcePool pool_;
 
+    /**
+     * @brief Registry of live threads.
+     */
+    ThreadRegistry registry_;
+
 };
 
+template <class F>
+api::Thread* Scheduler::createThread(F const& function, size_t const stackSize)
+{
+    api::Thread* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        ptr = check( new Resource(function, stackSize) );
+    }
+    return ptr;
+}
+
 } // namespace sys
 } // namespace eoos
 #endif // SYS_SCHEDULER_HPP_
@@ -8,6 +8,7 @@
 
 #include "sys.NonCopyable.hpp"
 #include "api.Semaphore.hpp"
+#include "sys.Clock.hpp"
 
 namespace eoos
 {
@@ -17,11 +18,17 @@ namespace sys
 /**
  * @class Semaphore
  * @brief Semaphore class.
+ *
+ * @note The order waiters are woken up in depends on the scheduling policy,
+ *       FairSemaphore grants permits in FIFO order whatever the policy is.
+ *
+ * @note A POSIX semaphore takes and returns one permit per call, so several permits cannot be
+ *       taken or returned atomically. FutexSemaphore and FairSemaphore do it with one wake-up pass.
  * 
  * @tparam A Heap memory allocator class.
  */
 template <class A>
-class Semaphore : public NonCopyable<A>, public api::Semaphore
+class Semaphore EOOS_SYS_FINAL : public NonCopyable<A>, public api::Semaphore
 {
     typedef NonCopyable<A> Parent;
 
@@ -49,6 +56,29 @@ public:
      */
     virtual bool_t acquire();
 
+    /**
+     * @brief Acquires one permit if it is available.
+     *
+     * @return True if the permit has been acquired.
+     */
+    bool_t tryAcquire();
+
+    /**
+     * @brief Acquires one permit waiting for it for a time.
+     *
+     * @param timeout Relative time to wait.
+     * @return True if the permit has been acquired, false if timed out or an error occurred.
+     */
+    bool_t acquire(::timespec const& timeout);
+
+    /**
+     * @brief Acquires one permit waiting for it until a deadline.
+     *
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock.
+     * @return True if the permit has been acquired, false if timed out or an error occurred.
+     */
+    bool_t acquireUntil(::timespec const& deadline);
+
     /**
      * @copydoc eoos::api::Semaphore::release()
      */
@@ -79,18 +109,6 @@ private:
      */
     void deinitialize();
 
-    /**
-     * @brief Test if semaphore is fair.
-     *
-     * @return Fairness flag.
-     */
-    static bool_t isFair();
-
-    /**
-     * @brief Fairness flag.
-     */
-    bool_t isFair_;
-    
     /**
      * @brief Number of permits available.
      */
@@ -107,7 +125,6 @@ template <class A>
 Semaphore<A>::Semaphore(int32_t permits) 
     : NonCopyable<A>()
     , api::Semaphore()
-    , isFair_(false)
     , permits_(permits)
     , sem_(){
     bool_t const isConstructed( construct() );
@@ -130,9 +147,14 @@ template <class A>
 bool_t Semaphore<A>::acquire()
 {
     bool_t res( false );
-    if( isConstructed() )
+    if( Parent::isUsable() )
     {
-        int_t const error( ::sem_wait(&sem_) );
+        int_t error( ::sem_wait(&sem_) );
+        // A signal handler interrupts the wait, which is then continued
+        while( (error != 0) && (errno == EINTR) )
+        {
+            error = ::sem_wait(&sem_);
+        }
         if( error == 0 ) 
         { 
             res = true; 
@@ -141,11 +163,58 @@ bool_t Semaphore<A>::acquire()
     return res;
 }
 
+template <class A>
+bool_t Semaphore<A>::tryAcquire()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        int_t const error( ::sem_trywait(&sem_) );
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t Semaphore<A>::acquire(::timespec const& timeout)
+{
+    bool_t res( false );
+    ::timespec deadline;
+    if( Clock::getDeadline(timeout, deadline) )
+    {
+        res = acquireUntil(deadline);
+    }
+    return res;
+}
+
+template <class A>
+bool_t Semaphore<A>::acquireUntil(::timespec const& deadline)
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        int_t error( ::sem_clockwait(&sem_, CLOCK_MONOTONIC, &deadline) );
+        // A signal handler interrupts the wait, which is then continued until the same deadline
+        while( (error != 0) && (errno == EINTR) )
+        {
+            error = ::sem_clockwait(&sem_, CLOCK_MONOTONIC, &deadline);
+        }
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
 template <class A>
 bool_t Semaphore<A>::release()
 {
     bool_t res( false );
-    if( isConstructed() )
+    if( Parent::isUsable() )
     {
         int_t const error( ::sem_post(&sem_) );
         if( error == 0 )
@@ -164,7 +233,6 @@ bool_t Semaphore<A>::construct()
     {
         if( initialize() )
         {
-            isFair_ = isFair();
             res = true;
         }
     }
@@ -184,14 +252,6 @@ void Semaphore<A>::deinitialize()
     static_cast<void>( ::sem_destroy(&sem_) );
 }
 
-
-template <class A>
-bool_t Semaphore<A>::isFair()
-{
-    int_t const policy( ::sched_getscheduler(0) );
-    return ( (policy == SCHED_FIFO) || (policy == SCHED_RR) ) ? true : false;  ///< SCA MISRA-C++:2008 Justified Rule 16-2-2
-}
-
 } // namespace sys
 } // namespace eoos
 #endif // SYS_SEMAPHORE_HPP_
@@ -9,8 +9,13 @@
 #include "sys.NonCopyable.hpp"
 #include "api.SemaphoreManager.hpp"
 #include "sys.Semaphore.hpp"
-#include "sys.Mutex.hpp"
-#include "lib.ResourceMemory.hpp"
+#include "sys.SharedSemaphore.hpp"
+#include "sys.FutexSemaphore.hpp"
+#include "sys.FairSemaphore.hpp"
+#include "sys.EventSemaphore.hpp"
+#include "sys.NamedSemaphore.hpp"
+#include "sys.ResourceMemory.hpp"
+#include "sys.ResourceArray.hpp"
 
 namespace eoos
 {
@@ -24,10 +29,114 @@ namespace sys
 class SemaphoreManager : public NonCopyable<NoAllocator>, public api::SemaphoreManager
 {
     typedef NonCopyable<NoAllocator> Parent;
-    typedef Semaphore<SemaphoreManager> Resource;
+
+    /**
+     * @enum Pool
+     * @brief Memory pools of semaphore kinds.
+     */
+    enum Pool
+    {
+        POOL_POSIX  = 0,
+        POOL_SHARED = 1,
+        POOL_EVENT  = 2,
+        POOL_NAMED  = 3,
+        POOL_FUTEX  = 4,
+        POOL_FAIR   = 5
+    };
+
+    /**
+     * @brief Number of memory pools.
+     */
+    static const int32_t NUMBER_OF_POOLS = 6;
+
+    /**
+     * @class Allocator
+     * @brief Allocator of semaphores of one kind, which are allocated in their own memory pool.
+     *
+     * @tparam P Memory pool of the semaphore kind.
+     */
+    template <int32_t P>
+    class Allocator
+    {
+
+    public:
+
+        /**
+         * @brief Allocates memory.
+         *
+         * @param size Number of bytes to allocate.
+         * @return Allocated memory address or a null pointer.
+         */
+        static void* allocate(size_t size);
+
+        /**
+         * @brief Frees allocated memory.
+         *
+         * @param ptr Address of allocated memory block or a null pointer.
+         */
+        static void free(void* ptr);
+
+        /**
+         * @brief Heap for resource allocation.
+         */
+        static api::Heap* resource_;
+
+    };
 
 public:
 
+    /**
+     * @brief POSIX unnamed semaphore, which calls of acquire and release are bound statically through.
+     */
+    typedef Semaphore< Allocator<POOL_POSIX> > Resource;
+
+    /**
+     * @brief Semaphore shared by processes.
+     */
+    typedef SharedSemaphore< Allocator<POOL_SHARED> > SharedResource;
+
+    /**
+     * @brief Semaphore on an event file descriptor.
+     */
+    typedef EventSemaphore< Allocator<POOL_EVENT> > EventResource;
+
+    /**
+     * @brief POSIX named semaphore.
+     */
+    typedef NamedSemaphore< Allocator<POOL_NAMED> > NamedResource;
+
+    /**
+     * @brief Semaphore on a futex word, which acquires and releases a number of permits at once.
+     */
+    typedef FutexSemaphore< Allocator<POOL_FUTEX> > FutexResource;
+
+    /**
+     * @brief Semaphore granting permits in FIFO order, which acquires and releases a number of permits at once.
+     */
+    typedef FairSemaphore< Allocator<POOL_FAIR> > FairResource;
+
+    /**
+     * @brief Caller provided memory a semaphore can be created in.
+     */
+    typedef ResourceStorage<Resource> Storage;
+
+    /**
+     * @brief Array of semaphores placed in one memory block.
+     */
+    typedef ResourceArray<Resource, SemaphoreManager> Array;
+
+    /**
+     * @enum Type
+     * @brief Semaphore implementations.
+     */
+    enum Type
+    {
+        TYPE_POSIX = 0, ///< @brief POSIX unnamed semaphore
+        TYPE_FUTEX = 1, ///< @brief Semaphore on a futex word which spins before blocking
+        TYPE_FAIR  = 2, ///< @brief Semaphore which grants permits in FIFO order
+        TYPE_EVENT = 3  ///< @brief Semaphore on an event file descriptor
+    };
+
     /**
      * @brief Constructor.
      */
@@ -46,7 +155,113 @@ public:
     /**
      * @copydoc eoos::api::SemaphoreManager::create()
      */
-    virtual api::Semaphore* create(int32_t permits);
+    virtual Resource* create(int32_t permits);
+
+    /**
+     * @brief Creates a new semaphore resource of an implementation.
+     *
+     * @param permits The initial number of permits available.
+     * @param type    A semaphore implementation.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    api::Semaphore* create(int32_t permits, Type type);
+
+    /**
+     * @brief Creates a new semaphore resource on a futex word.
+     *
+     * @param permits The initial number of permits available.
+     * @return A new semaphore resource which acquires and releases a number of permits at once,
+     *         or NULLPTR if an error has been occurred.
+     */
+    FutexResource* createFutex(int32_t permits);
+
+    /**
+     * @brief Creates a new semaphore resource which grants permits in FIFO order.
+     *
+     * @param permits The initial number of permits available.
+     * @return A new semaphore resource which acquires and releases a number of permits at once,
+     *         or NULLPTR if an error has been occurred.
+     */
+    FairResource* createFair(int32_t permits);
+
+    /**
+     * @brief Creates a new semaphore resource in caller provided memory.
+     *
+     * @note The resource shall be destroyed by destroy() before the memory is released or reused.
+     *
+     * @param storage Memory the semaphore is created in.
+     * @param permits The initial number of permits available.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    Resource* create(Storage& storage, int32_t permits);
+
+    /**
+     * @brief Destroys a semaphore resource created in caller provided memory.
+     *
+     * @param storage Memory a semaphore resource has been created in by create(Storage&,int32_t) which did not return NULLPTR.
+     */
+    void destroy(Storage& storage);
+
+    /**
+     * @brief Creates a new array of semaphore resources placed in one memory block.
+     *
+     * @note The array and all its semaphores are released at once by deleting the array.
+     *
+     * @param length  Number of semaphores.
+     * @param permits The initial number of permits available of each semaphore.
+     * @return A new array of semaphore resources, or NULLPTR if an error has been occurred.
+     */
+    Array* createArray(int32_t length, int32_t permits);
+
+    /**
+     * @brief Creates a new semaphore resource on an event file descriptor.
+     *
+     * @param permits The initial number of permits available.
+     * @return A new semaphore resource which descriptor can be polled, or NULLPTR if an error has been occurred.
+     */
+    EventResource* createEvent(int32_t permits);
+
+    /**
+     * @brief Creates a new semaphore resource shared by processes.
+     *
+     * @param name    Name of a shared memory object the semaphore is placed in, which starts with a slash.
+     * @param permits The initial number of permits available, which is set by the first created semaphore.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    SharedResource* createShared(char_t const* name, int32_t permits);
+
+    /**
+     * @brief Removes name of a shared memory object of semaphores shared by processes.
+     *
+     * @param name Name of a shared memory object which starts with a slash.
+     * @return True if the name is removed.
+     */
+    bool_t removeShared(char_t const* name);
+
+    /**
+     * @brief Creates a new POSIX named semaphore resource shared by processes.
+     *
+     * @param name    Name of a semaphore which starts with a slash.
+     * @param permits The initial number of permits available, which is set by the first created semaphore.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    NamedResource* createNamed(char_t const* name, int32_t permits);
+
+    /**
+     * @brief Removes name of POSIX named semaphores.
+     *
+     * @param name Name of a semaphore which starts with a slash.
+     * @return True if the name is removed.
+     */
+    bool_t removeNamed(char_t const* name);
+
+    /**
+     * @brief Returns statistics of the resource memory pools.
+     *
+     * @param statistics Statistics the sums of the pools statistics are copied to.
+     * @return True if the statistics are got.
+     */
+    bool_t getStatistics(ResourceStatistics& statistics) const;
 
     /**
      * @brief Allocates memory.
@@ -88,10 +303,10 @@ private:
      * @brief Initializes the allocator.
      */
     static void deinitialize();
-    
+
     /**
      * @struct ResourcePool
-     * @brief Resource memory pool.
+     * @brief Resource memory pools, one per semaphore kind, so each slot is of its semaphore size.
      */
     struct ResourcePool
     {
@@ -103,19 +318,35 @@ private:
          */
         ResourcePool();
 
-    private:
-            
         /**
-         * @brief Mutex resource.
-         */    
-        Mutex<NoAllocator> mutex_;
-        
-    public:
-        
+         * @brief POSIX unnamed semaphore memory allocator.
+         */
+        ResourceMemory<Resource, EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES> posix;
+
+        /**
+         * @brief Semaphore shared by processes memory allocator.
+         */
+        ResourceMemory<SharedResource, EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES> shared;
+
+        /**
+         * @brief Semaphore on an event file descriptor memory allocator.
+         */
+        ResourceMemory<EventResource, EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES> event;
+
+        /**
+         * @brief POSIX named semaphore memory allocator.
+         */
+        ResourceMemory<NamedResource, EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES> named;
+
+        /**
+         * @brief Semaphore on a futex word memory allocator.
+         */
+        ResourceMemory<FutexResource, EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES> futex;
+
         /**
-         * @brief Semaphore memory allocator.
-         */     
-        lib::ResourceMemory<Resource, EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES> memory;
+         * @brief Semaphore granting permits in FIFO order memory allocator.
+         */
+        ResourceMemory<FairResource, EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES> fair;
 
     };    
 
@@ -131,6 +362,29 @@ private:
     
 };
 
+template <int32_t P>
+api::Heap* SemaphoreManager::Allocator<P>::resource_( NULLPTR );
+
+template <int32_t P>
+void* SemaphoreManager::Allocator<P>::allocate(size_t size)
+{
+    void* addr( NULLPTR );
+    if( resource_ != NULLPTR )
+    {
+        addr = resource_->allocate(size, NULLPTR);
+    }
+    return addr;
+}
+
+template <int32_t P>
+void SemaphoreManager::Allocator<P>::free(void* ptr)
+{
+    if( resource_ != NULLPTR )
+    {
+        resource_->free(ptr);
+    }
+}
+
 } // namespace sys
 } // namespace eoos
 #endif // SYS_SEMAPHOREMANAGER_HPP_
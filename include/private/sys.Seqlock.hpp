@@ -0,0 +1,214 @@
+/**
+ * @file      sys.Seqlock.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SEQLOCK_HPP_
+#define SYS_SEQLOCK_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Spin.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Seqlock
+ * @brief Sequence lock of a value for lock-free readers.
+ *
+ * A writer makes the sequence odd, changes the value and makes the sequence even again.
+ * A reader copies the value and retries if the sequence has been odd or changed during the copying.
+ * The value is copied by atomic memory words, so concurrent writing does not lead to a data race.
+ *
+ * @tparam T Value type which shall be trivially copyable.
+ * @tparam A Heap memory allocator class.
+ */
+template <class T, class A = NoAllocator>
+class Seqlock : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param value Initial value.
+     */
+    explicit Seqlock(T const& value);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Seqlock();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Reads the value.
+     *
+     * @param value Value the read value is copied to.
+     * @return True if the value is read.
+     */
+    bool_t read(T& value) const;
+
+    /**
+     * @brief Writes the value.
+     *
+     * @note Concurrent writers are serialized with each other, but spin while other writer is writing.
+     *
+     * @param value Value to be written.
+     * @return True if the value is written.
+     */
+    bool_t write(T const& value);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Number of memory words of the value.
+     */
+    static const size_t WORDS = ( sizeof(T) + sizeof(uint64_t) - 1U ) / sizeof(uint64_t);
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param value Initial value.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(T const& value);
+
+    /**
+     * @brief Copies value to the memory words.
+     *
+     * @param value A value.
+     */
+    void store(T const& value);
+
+    /**
+     * @brief Sequence which is odd while the value is being written.
+     */
+    uint32_t sequence_;
+
+    /**
+     * @brief Memory words of the value.
+     */
+    uint64_t data_[WORDS];
+
+};
+
+template <class T, class A>
+Seqlock<T,A>::Seqlock(T const& value)
+    : NonCopyable<A>()
+    , sequence_(0U)
+    , data_() {
+    bool_t const isConstructed( construct(value) );
+    setConstructed( isConstructed );
+}
+
+template <class T, class A>
+Seqlock<T,A>::~Seqlock()
+{
+}
+
+template <class T, class A>
+bool_t Seqlock<T,A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class T, class A>
+bool_t Seqlock<T,A>::read(T& value) const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        uint64_t data[WORDS];
+        uint32_t begin( 0U );
+        uint32_t end( 0U );
+        do
+        {
+            begin = __atomic_load_n(&sequence_, __ATOMIC_ACQUIRE);
+            if( (begin & 1U) != 0U )
+            {
+                Spin::relax();
+                continue;
+            }
+            for(size_t i(0U); i < WORDS; ++i)
+            {
+                data[i] = __atomic_load_n(&data_[i], __ATOMIC_RELAXED);
+            }
+            // Keeps the sequence check after the copying
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            end = __atomic_load_n(&sequence_, __ATOMIC_RELAXED);
+        }
+        while( ( (begin & 1U) != 0U ) || (begin != end) );
+        static_cast<void>( ::memcpy(&value, data, sizeof(T)) );
+        res = true;
+    }
+    return res;
+}
+
+template <class T, class A>
+bool_t Seqlock<T,A>::write(T const& value)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        uint32_t sequence( __atomic_load_n(&sequence_, __ATOMIC_RELAXED) );
+        bool_t isLocked( false );
+        do
+        {
+            if( (sequence & 1U) != 0U )
+            {
+                Spin::relax();
+                sequence = __atomic_load_n(&sequence_, __ATOMIC_RELAXED);
+                continue;
+            }
+            isLocked = __atomic_compare_exchange_n(&sequence_, &sequence, sequence + 1U, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+        }
+        while( !isLocked );
+        // Keeps the copying after the sequence is odd
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        store(value);
+        __atomic_store_n(&sequence_, sequence + 2U, __ATOMIC_RELEASE);
+        res = true;
+    }
+    return res;
+}
+
+template <class T, class A>
+bool_t Seqlock<T,A>::construct(T const& value)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        store(value);
+        res = true;
+    }
+    return res;
+}
+
+template <class T, class A>
+void Seqlock<T,A>::store(T const& value)
+{
+    uint64_t data[WORDS];
+    data[WORDS - 1U] = 0U;
+    static_cast<void>( ::memcpy(data, &value, sizeof(T)) );
+    for(size_t i(0U); i < WORDS; ++i)
+    {
+        __atomic_store_n(&data_[i], data[i], __ATOMIC_RELAXED);
+    }
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SEQLOCK_HPP_
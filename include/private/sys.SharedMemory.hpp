@@ -0,0 +1,152 @@
+/**
+ * @file      sys.SharedMemory.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SHAREDMEMORY_HPP_
+#define SYS_SHAREDMEMORY_HPP_
+
+#include "sys.NonCopyable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class SharedMemory
+ * @brief Named shared memory of cooperating processes.
+ *
+ * The memory begins with a header which state makes only one process initialize the memory content.
+ * The state of the content being initialized is the identifier of the initializing process, so if
+ * the process terminates, other process takes the initialization over.
+ */
+class SharedMemory : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @enum Initialization
+     * @brief Results of the initialization beginning.
+     */
+    enum Initialization
+    {
+        INITIALIZATION_REQUIRED = 0, ///< @brief The caller shall initialize the memory content
+        INITIALIZATION_DONE = 1,     ///< @brief The memory content has been initialized
+        INITIALIZATION_FAILED = 2    ///< @brief Other process has not initialized the memory content in time
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param name Name of a shared memory object which starts with a slash.
+     * @param size Size of the memory content in bytes.
+     */
+    SharedMemory(char_t const* name, size_t size);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~SharedMemory();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Returns address of the memory content.
+     *
+     * @return The address aligned to the cache line size, or NULLPTR if the object is not constructed.
+     */
+    void* getAddress() const;
+
+    /**
+     * @brief Begins initialization of the memory content.
+     *
+     * The function waits while other process initializes the memory content for
+     * EOOS_GLOBAL_SYS_SHARED_MEMORY_TIMEOUT milliseconds, and takes the initialization
+     * over if the process has terminated.
+     *
+     * @return The initialization result.
+     */
+    Initialization beginInitialization();
+
+    /**
+     * @brief Ends initialization of the memory content.
+     *
+     * @param isInitialized True if the caller has initialized the memory content successfully.
+     */
+    void endInitialization(bool_t isInitialized);
+
+    /**
+     * @brief Removes name of a shared memory object.
+     *
+     * @note Processes which have mapped the object keep using it, but new ones get a new object.
+     *
+     * @param name Name of a shared memory object which starts with a slash.
+     * @return True if the name is removed.
+     */
+    static bool_t remove(char_t const* name);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @enum State
+     * @brief Memory content states.
+     */
+    enum State
+    {
+        STATE_NEW = 0,   ///< @brief The content is not initialized
+        STATE_READY = -1 ///< @brief The content is initialized, and a positive state is the initializing process identifier
+    };
+
+    /**
+     * @brief Size of the memory header.
+     */
+    static const size_t HEADER_SIZE = EOOS_GLOBAL_SYS_CACHE_LINE_SIZE;
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param name Name of a shared memory object.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(char_t const* name);
+
+    /**
+     * @brief Returns the state of the memory content.
+     *
+     * @return The state futex word placed in the header.
+     */
+    int32_t* getState() const;
+
+    /**
+     * @brief Tests if a process has terminated.
+     *
+     * @param pid A process identifier.
+     * @return True if the process does not exist.
+     */
+    static bool_t isTerminated(int32_t pid);
+
+    /**
+     * @brief Size of the mapped memory.
+     */
+    size_t size_;
+
+    /**
+     * @brief Address of the mapped memory.
+     */
+    void* addr_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SHAREDMEMORY_HPP_
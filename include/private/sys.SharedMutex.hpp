@@ -0,0 +1,261 @@
+/**
+ * @file      sys.SharedMutex.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SHAREDMUTEX_HPP_
+#define SYS_SHAREDMUTEX_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Mutex.hpp"
+#include "sys.SharedMemory.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class SharedMutex.
+ * @brief Robust mutex shared by processes.
+ *
+ * The mutex is placed in named shared memory. If an owner process terminates,
+ * the next locker gets the mutex and makes it consistent, so the protected data might be inconsistent.
+ * The locker is told about it by the lock functions with the owner death flag, and shall repair the data.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class SharedMutex EOOS_SYS_FINAL : public NonCopyable<A>, public api::Mutex
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param name Name of a shared memory object which starts with a slash.
+     */
+    explicit SharedMutex(char_t const* name);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~SharedMutex();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Mutex::tryLock()
+     */
+    virtual bool_t tryLock();
+
+    /**
+     * @copydoc eoos::api::Mutex::lock()
+     */
+    virtual bool_t lock();
+
+    /**
+     * @copydoc eoos::api::Mutex::unlock()
+     */
+    virtual bool_t unlock();
+
+    /**
+     * @brief Tries to lock this mutex reporting death of its previous owner.
+     *
+     * @param isOwnerDead Set to true if the mutex has been got from an owner which has terminated.
+     * @return True if this mutex has been locked.
+     */
+    bool_t tryLock(bool_t& isOwnerDead);
+
+    /**
+     * @brief Locks this mutex reporting death of its previous owner.
+     *
+     * @param isOwnerDead Set to true if the mutex has been got from an owner which has terminated.
+     * @return True if this mutex has been locked.
+     */
+    bool_t lock(bool_t& isOwnerDead);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes kernel mutex resource.
+     *
+     * @return True if initialized sucessfully.
+     */
+    bool_t initialize();
+
+    /**
+     * @brief Makes the mutex consistent if its owner has terminated.
+     *
+     * @param error       An error of the mutex locking.
+     * @param isOwnerDead Set to true if the owner has terminated.
+     * @return The error after the mutex has been made consistent.
+     */
+    int_t recover(int_t error, bool_t& isOwnerDead);
+
+    /**
+     * @brief Shared memory the mutex is placed in.
+     */
+    SharedMemory memory_;
+
+    /**
+     * @brief Mutex POSIX resource identifier.
+     */
+    ::pthread_mutex_t* mutex_;
+
+};
+
+template <class A>
+SharedMutex<A>::SharedMutex(char_t const* const name)
+    : NonCopyable<A>()
+    , api::Mutex()
+    , memory_(name, sizeof(::pthread_mutex_t))
+    , mutex_(NULLPTR) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+SharedMutex<A>::~SharedMutex()
+{
+}
+
+template <class A>
+bool_t SharedMutex<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t SharedMutex<A>::tryLock()
+{
+    bool_t isOwnerDead( false );
+    return tryLock(isOwnerDead);
+}
+
+template <class A>
+bool_t SharedMutex<A>::lock()
+{
+    bool_t isOwnerDead( false );
+    return lock(isOwnerDead);
+}
+
+template <class A>
+bool_t SharedMutex<A>::unlock()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        int_t const error( ::pthread_mutex_unlock(mutex_) );
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t SharedMutex<A>::tryLock(bool_t& isOwnerDead)
+{
+    bool_t res( false );
+    isOwnerDead = false;
+    if( Parent::isUsable() )
+    {
+        int_t const error( recover( ::pthread_mutex_trylock(mutex_), isOwnerDead ) );
+        res = (error == 0) ? true : false;
+    }
+    return res;
+}
+
+template <class A>
+bool_t SharedMutex<A>::lock(bool_t& isOwnerDead)
+{
+    bool_t res( false );
+    isOwnerDead = false;
+    if( Parent::isUsable() )
+    {
+        int_t const error( recover( ::pthread_mutex_lock(mutex_), isOwnerDead ) );
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t SharedMutex<A>::construct()
+{
+    bool_t res( false );
+    if( isConstructed() && memory_.isConstructed() )
+    {
+        mutex_ = static_cast< ::pthread_mutex_t* >( memory_.getAddress() );
+        SharedMemory::Initialization const initialization( memory_.beginInitialization() );
+        if( initialization == SharedMemory::INITIALIZATION_REQUIRED )
+        {
+            res = initialize();
+            memory_.endInitialization(res);
+        }
+        else
+        {
+            res = initialization == SharedMemory::INITIALIZATION_DONE;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t SharedMutex<A>::initialize()
+{
+    bool_t res( false );
+    ::pthread_mutexattr_t attr;
+    int_t error( ::pthread_mutexattr_init(&attr) );
+    if( error == 0 )
+    {
+        error = ::pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+        if( error == 0 )
+        {
+            error = ::pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+        }
+        if( error == 0 )
+        {
+            error = ::pthread_mutex_init(mutex_, &attr);
+        }
+        res = error == 0;
+        static_cast<void>( ::pthread_mutexattr_destroy(&attr) );
+    }
+    return res;
+}
+
+template <class A>
+int_t SharedMutex<A>::recover(int_t const error, bool_t& isOwnerDead)
+{
+    int_t res( error );
+    if( error == EOWNERDEAD )
+    {
+        isOwnerDead = true;
+        res = ::pthread_mutex_consistent(mutex_);
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SHAREDMUTEX_HPP_
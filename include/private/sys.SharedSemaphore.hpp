@@ -0,0 +1,168 @@
+/**
+ * @file      sys.SharedSemaphore.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SHAREDSEMAPHORE_HPP_
+#define SYS_SHAREDSEMAPHORE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Semaphore.hpp"
+#include "sys.SharedMemory.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class SharedSemaphore
+ * @brief Semaphore shared by processes.
+ *
+ * The semaphore is placed in named shared memory, and the number of permits
+ * is set by the process which initializes the semaphore first.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class SharedSemaphore EOOS_SYS_FINAL : public NonCopyable<A>, public api::Semaphore
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param name    Name of a shared memory object which starts with a slash.
+     * @param permits The initial number of permits available.
+     */
+    SharedSemaphore(char_t const* name, int32_t permits);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~SharedSemaphore();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Semaphore::acquire()
+     */
+    virtual bool_t acquire();
+
+    /**
+     * @copydoc eoos::api::Semaphore::release()
+     */
+    virtual bool_t release();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param permits The initial number of permits available.
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct(int32_t permits);
+
+    /**
+     * @brief Shared memory the semaphore is placed in.
+     */
+    SharedMemory memory_;
+
+    /**
+     * @brief Semaphore resource identifier.
+     */
+    ::sem_t* sem_;
+
+};
+
+template <class A>
+SharedSemaphore<A>::SharedSemaphore(char_t const* const name, int32_t const permits)
+    : NonCopyable<A>()
+    , api::Semaphore()
+    , memory_(name, sizeof(::sem_t))
+    , sem_(NULLPTR) {
+    bool_t const isConstructed( construct(permits) );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+SharedSemaphore<A>::~SharedSemaphore()
+{
+}
+
+template <class A>
+bool_t SharedSemaphore<A>::isConstructed() const ///< SCA MISRA-C++:2008 Justified Rule 10-3-1
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t SharedSemaphore<A>::acquire()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        int_t error( ::sem_wait(sem_) );
+        // A signal handler interrupts the wait, which is then continued
+        while( (error != 0) && (errno == EINTR) )
+        {
+            error = ::sem_wait(sem_);
+        }
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t SharedSemaphore<A>::release()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        int_t const error( ::sem_post(sem_) );
+        if( error == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t SharedSemaphore<A>::construct(int32_t const permits)
+{
+    bool_t res( false );
+    if( isConstructed() && memory_.isConstructed() && (permits >= 0) )
+    {
+        sem_ = static_cast< ::sem_t* >( memory_.getAddress() );
+        SharedMemory::Initialization const initialization( memory_.beginInitialization() );
+        if( initialization == SharedMemory::INITIALIZATION_REQUIRED )
+        {
+            int_t const error( ::sem_init(sem_, 1, static_cast<uint_t>(permits)) );
+            res = error == 0;
+            memory_.endInitialization(res);
+        }
+        else
+        {
+            res = initialization == SharedMemory::INITIALIZATION_DONE;
+        }
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SHAREDSEMAPHORE_HPP_
@@ -0,0 +1,80 @@
+/**
+ * @file      sys.Spin.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SPIN_HPP_
+#define SYS_SPIN_HPP_
+
+#include "sys.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Spin
+ * @brief Busy-wait helpers of spinning primitives.
+ */
+class Spin
+{
+
+public:
+
+    /**
+     * @brief Returns number of spins before a waiter blocks.
+     *
+     * @param count Number of spins on multiprocessor systems.
+     * @return The number, or zero on uniprocessor systems as the thread waited for cannot run while a waiter spins.
+     */
+    static int32_t getCount(int32_t count);
+
+    /**
+     * @brief Hints CPU the caller spins, or yields the CPU on uniprocessor systems.
+     */
+    static void relax();
+
+private:
+
+    /**
+     * @brief Tests if the system has more than one online CPU.
+     *
+     * @return True if the system is multiprocessor.
+     */
+    static bool_t isMultiprocessor();
+
+};
+
+inline int32_t Spin::getCount(int32_t const count)
+{
+    return isMultiprocessor() ? count : 0;
+}
+
+inline void Spin::relax()
+{
+    if( !isMultiprocessor() )
+    {
+        static_cast<void>( ::sched_yield() );
+    }
+    else
+    {
+        #if defined (__i386__) || defined (__x86_64__)
+        __builtin_ia32_pause();
+        #elif defined (__aarch64__) || defined (__arm__)
+        __asm__ __volatile__ ("yield" ::: "memory");
+        #else
+        __atomic_signal_fence(__ATOMIC_SEQ_CST);
+        #endif
+    }
+}
+
+inline bool_t Spin::isMultiprocessor()
+{
+    static bool_t const is( ::sysconf(_SC_NPROCESSORS_ONLN) > 1L );
+    return is;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SPIN_HPP_
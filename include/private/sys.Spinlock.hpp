@@ -0,0 +1,200 @@
+/**
+ * @file      sys.Spinlock.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SPINLOCK_HPP_
+#define SYS_SPINLOCK_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Mutex.hpp"
+#include "api.Scheduler.hpp"
+#include "sys.Spin.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Spinlock
+ * @brief Spinlock class for very short critical sections.
+ *
+ * A locker reads the lock word until it is free and only then tries to exchange it,
+ * so waiters spin in their own caches. After each failed try the locker pauses for
+ * twice as long as before, and if a scheduler is given, it yields the CPU through
+ * the scheduler once the pause has reached its maximum.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class Spinlock EOOS_SYS_FINAL : public NonCopyable<A>, public api::Mutex
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param scheduler A scheduler to yield the CPU through, or NULLPTR to spin only.
+     */
+    explicit Spinlock(api::Scheduler* scheduler);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Spinlock();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Mutex::tryLock()
+     */
+    virtual bool_t tryLock();
+
+    /**
+     * @copydoc eoos::api::Mutex::lock()
+     */
+    virtual bool_t lock();
+
+    /**
+     * @copydoc eoos::api::Mutex::unlock()
+     */
+    virtual bool_t unlock();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Maximum number of pauses after a failed try.
+     */
+    static const int32_t MAXIMUM_BACKOFF = 1024;
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Tries to take the lock word.
+     *
+     * @return True if the lock word has been taken.
+     */
+    bool_t take();
+
+    /**
+     * @brief Scheduler to yield the CPU through.
+     */
+    api::Scheduler* scheduler_;
+
+    /**
+     * @brief Lock word which is non-zero if the lock is taken.
+     */
+    int32_t lock_;
+
+};
+
+template <class A>
+Spinlock<A>::Spinlock(api::Scheduler* const scheduler)
+    : NonCopyable<A>()
+    , api::Mutex()
+    , scheduler_(scheduler)
+    , lock_(0) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+Spinlock<A>::~Spinlock()
+{
+}
+
+template <class A>
+bool_t Spinlock<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t Spinlock<A>::tryLock()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        res = take();
+    }
+    return res;
+}
+
+template <class A>
+bool_t Spinlock<A>::lock()
+{
+    bool_t res( false );
+    if( Parent::isUsable() )
+    {
+        int32_t backoff( 1 );
+        while( !take() )
+        {
+            for(int32_t i(0); i < backoff; ++i)
+            {
+                Spin::relax();
+            }
+            if( backoff < MAXIMUM_BACKOFF )
+            {
+                backoff *= 2;
+            }
+            else if( scheduler_ != NULLPTR )
+            {
+                static_cast<void>( scheduler_->yield() );
+            }
+            else
+            {
+                // Spins with the maximum backoff
+            }
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t Spinlock<A>::unlock()
+{
+    bool_t res( false );
+    if( Parent::isUsable() && (__atomic_load_n(&lock_, __ATOMIC_RELAXED) != 0) )
+    {
+        __atomic_store_n(&lock_, 0, __ATOMIC_RELEASE);
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t Spinlock<A>::construct()
+{
+    return isConstructed();
+}
+
+template <class A>
+inline bool_t Spinlock<A>::take()
+{
+    bool_t res( false );
+    if( __atomic_load_n(&lock_, __ATOMIC_RELAXED) == 0 )
+    {
+        res = __atomic_exchange_n(&lock_, 1, __ATOMIC_ACQUIRE) == 0;
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SPINLOCK_HPP_
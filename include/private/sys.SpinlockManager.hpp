@@ -0,0 +1,151 @@
+/**
+ * @file      sys.SpinlockManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SPINLOCKMANAGER_HPP_
+#define SYS_SPINLOCKMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.MutexManager.hpp"
+#include "sys.Spinlock.hpp"
+#include "sys.ResourceMemory.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class SpinlockManager.
+ * @brief Spinlock sub-system manager.
+ */
+class SpinlockManager : public NonCopyable<NoAllocator>, public api::MutexManager
+{
+    typedef NonCopyable<NoAllocator> Parent;
+    typedef Spinlock<SpinlockManager> Resource;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param scheduler The system scheduler spinlocks yield the CPU through.
+     */
+    explicit SpinlockManager(api::Scheduler& scheduler);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~SpinlockManager();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Creates a new spinlock resource which yields the CPU through the scheduler.
+     *
+     * @return A new spinlock resource, or NULLPTR if an error has been occurred.
+     */
+    virtual api::Mutex* create();
+
+    /**
+     * @brief Creates a new spinlock resource.
+     *
+     * @param isYielding True if the spinlock yields the CPU through the scheduler after its backoff, or false to spin only.
+     * @return A new spinlock resource, or NULLPTR if an error has been occurred.
+     */
+    Spinlock<SpinlockManager>* create(bool_t isYielding);
+
+    /**
+     * @brief Returns statistics of the resource memory pool.
+     *
+     * @param statistics Statistics the pool statistics are copied to.
+     * @return True if the statistics are got.
+     */
+    bool_t getStatistics(ResourceStatistics& statistics) const;
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees allocated memory.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);        
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes the allocator with heap for resource allocation.
+     *
+     * @param resource Heap for resource allocation.
+     * @return True if initialized.
+     */
+    static bool_t initialize(api::Heap* resource);
+
+    /**
+     * @brief Initializes the allocator.
+     */
+    static void deinitialize();
+    
+    /**
+     * @struct ResourcePool
+     * @brief Resource memory pool.
+     */
+    struct ResourcePool
+    {
+
+    public:
+        
+        /**
+         * @brief Constructor.
+         */        
+        ResourcePool();
+
+        /**
+         * @brief Spinlock memory allocator.
+         */     
+        ResourceMemory<Resource, EOOS_GLOBAL_SYS_NUMBER_OF_SPINLOCKS> memory;
+
+    };
+
+    /**
+     * @brief Heap for resource allocation.
+     */
+    static api::Heap* resource_;
+        
+    /**
+     * @brief The system scheduler.
+     */
+    api::Scheduler& scheduler_;
+
+    /**
+     * @brief Resource memory pool.
+     */
+    ResourcePool pool_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SPINLOCKMANAGER_HPP_
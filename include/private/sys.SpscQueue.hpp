@@ -0,0 +1,316 @@
+/**
+ * @file      sys.SpscQueue.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SPSCQUEUE_HPP_
+#define SYS_SPSCQUEUE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.QueueEvent.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class SpscQueue
+ * @brief Bounded single-producer single-consumer queue class.
+ *
+ * The queue is a ring of pointers which is indexed by the producer and the consumer counters
+ * placed on different cache lines. Putting and taking an element are wait-free. A blocking queue
+ * blocks the producer on a full queue and the consumer on an empty queue on futex events.
+ *
+ * @note One thread at a time shall put elements, and one thread at a time shall take elements.
+ *
+ * @tparam A Heap memory allocator class.
+ * @tparam L Maximum number of elements, which shall be a power of two.
+ */
+template <class A, int32_t L>
+class SpscQueue EOOS_SYS_FINAL : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param isBlocking True if the producer and the consumer block on a full and an empty queue.
+     */
+    explicit SpscQueue(bool_t isBlocking);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~SpscQueue();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Puts an element to the tail of the queue waiting while it is full if the queue is blocking.
+     *
+     * @param element An element.
+     * @return True if the element has been put.
+     */
+    bool_t push(void* element);
+
+    /**
+     * @brief Takes an element from the head of the queue waiting while it is empty if the queue is blocking.
+     *
+     * @param element An element taken.
+     * @return True if an element has been taken.
+     */
+    bool_t pop(void*& element);
+
+    /**
+     * @brief Puts an element to the tail of the queue if it is not full.
+     *
+     * @param element An element.
+     * @return True if the element has been put.
+     */
+    bool_t tryPush(void* element);
+
+    /**
+     * @brief Takes an element from the head of the queue if it is not empty.
+     *
+     * @param element An element taken.
+     * @return True if an element has been taken.
+     */
+    bool_t tryPop(void*& element);
+
+    /**
+     * @brief Returns maximum number of elements.
+     *
+     * @return Maximum number of elements.
+     */
+    int32_t getLength() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Mask of a cell index.
+     */
+    static const uint32_t MASK = static_cast<uint32_t>(L) - 1U;
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Puts an element if the queue is not full.
+     *
+     * @param element An element.
+     * @return True if the element has been put.
+     */
+    bool_t put(void* element);
+
+    /**
+     * @brief Takes an element if the queue is not empty.
+     *
+     * @param element An element taken.
+     * @return True if an element has been taken.
+     */
+    bool_t take(void*& element);
+
+    /**
+     * @brief Producer counter of elements put.
+     */
+    uint32_t tail_;
+
+    /**
+     * @brief Padding of the producer counter to a cache line.
+     */
+    uint8_t tailPadding_[EOOS_GLOBAL_SYS_CACHE_LINE_SIZE - sizeof(uint32_t)];
+
+    /**
+     * @brief Consumer counter of elements taken.
+     */
+    uint32_t head_;
+
+    /**
+     * @brief Padding of the consumer counter to a cache line.
+     */
+    uint8_t headPadding_[EOOS_GLOBAL_SYS_CACHE_LINE_SIZE - sizeof(uint32_t)];
+
+    /**
+     * @brief Cells of the elements.
+     */
+    void* cells_[L];
+
+    /**
+     * @brief Blocking flag.
+     */
+    bool_t isBlocking_;
+
+    /**
+     * @brief Event of an element put.
+     */
+    QueueEvent notEmpty_;
+
+    /**
+     * @brief Event of an element taken.
+     */
+    QueueEvent notFull_;
+
+};
+
+template <class A, int32_t L>
+SpscQueue<A,L>::SpscQueue(bool_t const isBlocking)
+    : NonCopyable<A>()
+    , tail_(0U)
+    , tailPadding_()
+    , head_(0U)
+    , headPadding_()
+    , cells_()
+    , isBlocking_(isBlocking)
+    , notEmpty_()
+    , notFull_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A, int32_t L>
+SpscQueue<A,L>::~SpscQueue()
+{
+}
+
+template <class A, int32_t L>
+bool_t SpscQueue<A,L>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A, int32_t L>
+bool_t SpscQueue<A,L>::push(void* const element)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = put(element);
+        while( !res && isBlocking_ )
+        {
+            int32_t const sequence( notFull_.enter() );
+            res = put(element);
+            if( !res )
+            {
+                notFull_.wait(sequence);
+            }
+            notFull_.leave();
+        }
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+bool_t SpscQueue<A,L>::pop(void*& element)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = take(element);
+        while( !res && isBlocking_ )
+        {
+            int32_t const sequence( notEmpty_.enter() );
+            res = take(element);
+            if( !res )
+            {
+                notEmpty_.wait(sequence);
+            }
+            notEmpty_.leave();
+        }
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+bool_t SpscQueue<A,L>::tryPush(void* const element)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = put(element);
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+bool_t SpscQueue<A,L>::tryPop(void*& element)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = take(element);
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+int32_t SpscQueue<A,L>::getLength() const
+{
+    return L;
+}
+
+template <class A, int32_t L>
+bool_t SpscQueue<A,L>::construct()
+{
+    bool_t res( false );
+    if( isConstructed() && (L > 0) && ( (static_cast<uint32_t>(L) & MASK) == 0U ) )
+    {
+        res = notEmpty_.isConstructed() && notFull_.isConstructed();
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+bool_t SpscQueue<A,L>::put(void* const element)
+{
+    bool_t res( false );
+    uint32_t const tail( __atomic_load_n(&tail_, __ATOMIC_RELAXED) );
+    uint32_t const head( __atomic_load_n(&head_, __ATOMIC_ACQUIRE) );
+    if( (tail - head) < static_cast<uint32_t>(L) )
+    {
+        cells_[tail & MASK] = element;
+        __atomic_store_n(&tail_, tail + 1U, __ATOMIC_RELEASE);
+        if( isBlocking_ )
+        {
+            notEmpty_.signal();
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A, int32_t L>
+bool_t SpscQueue<A,L>::take(void*& element)
+{
+    bool_t res( false );
+    uint32_t const head( __atomic_load_n(&head_, __ATOMIC_RELAXED) );
+    uint32_t const tail( __atomic_load_n(&tail_, __ATOMIC_ACQUIRE) );
+    if( tail != head )
+    {
+        element = cells_[head & MASK];
+        __atomic_store_n(&head_, head + 1U, __ATOMIC_RELEASE);
+        if( isBlocking_ )
+        {
+            notFull_.signal();
+        }
+        res = true;
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SPSCQUEUE_HPP_
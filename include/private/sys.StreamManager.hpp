@@ -18,6 +18,9 @@ namespace sys
 /**
  * @class StreamManager.
  * @brief Stream sub-system manager.
+ *
+ * The streams are published to readers with no locks. A stream which has been set shall not be destroyed
+ * until it is replaced and no thread which has got it uses it anymore.
  */
 class StreamManager : public NonCopyable<NoAllocator>, public api::StreamManager
 {
@@ -75,6 +78,14 @@ protected:
     using Parent::setConstructed;
 
 private:
+
+    /**
+     * @brief Sets a stream.
+     *
+     * @param stream The stream pointer to be set.
+     * @param value  A new stream.
+     */
+    void set(api::OutStream<char_t>** stream, api::OutStream<char_t>* value);
     
     /**
      * @brief The default system output character stream.
@@ -12,7 +12,13 @@
 #include "sys.Scheduler.hpp"
 #include "sys.MutexManager.hpp"
 #include "sys.SemaphoreManager.hpp"
+#include "sys.Rcu.hpp"
 #include "sys.StreamManager.hpp"
+#include "sys.ConditionVariableManager.hpp"
+#include "sys.SpinlockManager.hpp"
+#include "sys.BarrierManager.hpp"
+#include "sys.EventFlagsManager.hpp"
+#include "sys.QueueManager.hpp"
 #include "sys.Error.hpp"
 
 namespace eoos
@@ -70,6 +76,60 @@ public:
      */
     virtual api::StreamManager& getStreamManager();
 
+    /**
+     * @brief Returns the system condition variable manager.
+     *
+     * @return The condition variable manager.
+     */
+    ConditionVariableManager& getConditionVariableManager();
+
+    /**
+     * @brief Returns the system spinlock manager.
+     *
+     * @return The spinlock manager.
+     */
+    SpinlockManager& getSpinlockManager();
+
+    /**
+     * @brief Returns the system barrier and latch manager.
+     *
+     * @return The barrier manager.
+     */
+    BarrierManager& getBarrierManager();
+
+    /**
+     * @brief Returns the system event flags manager.
+     *
+     * @return The event flags manager.
+     */
+    EventFlagsManager& getEventFlagsManager();
+
+    /**
+     * @brief Returns the system queue manager.
+     *
+     * @return The queue manager.
+     */
+    QueueManager& getQueueManager();
+
+    /**
+     * @brief Returns the system RCU.
+     *
+     * The RCU is created on the first call, so a program which does not use it
+     * does not register the membarrier system call.
+     *
+     * @return The RCU, or NULLPTR if it cannot be created.
+     */
+    Rcu* getRcu();
+
+    /**
+     * @brief Takes a snapshot of statistics of the live threads created by the system scheduler.
+     *
+     * @param statistics An array the statistics are copied to.
+     * @param length     Number of elements of the array.
+     * @return Number of the live threads, which might exceed the array length, or -1 if an error occurred.
+     */
+    int32_t getThreadStatistics(ThreadStatistics* statistics, int32_t length);
+
     /**
      * @brief Executes the operating system.
      *
@@ -88,6 +148,11 @@ public:
 
 private:
 
+    /**
+     * @brief Maximum number of threads reported on stop.
+     */
+    static const int32_t REPORT_LENGTH = 16;
+
     /**
      * @brief Constructs this object.
      *
@@ -95,6 +160,11 @@ private:
      */
     bool_t construct();
 
+    /**
+     * @brief Reports the threads which have not returned on stop to the error stream.
+     */
+    void reportThreads();
+
     /**
      * @brief The operating system.
      */
@@ -104,6 +174,11 @@ private:
      * @brief The system heap.
      */
     Heap heap_;
+
+    /**
+     * @brief The system RCU, which is created on first use.
+     */
+    Rcu* rcu_;
  
     /**
      * @brief The operating system scheduler.
@@ -125,6 +200,31 @@ private:
      */
     StreamManager streamManager_;
 
+    /**
+     * @brief The condition variable sub-system manager.
+     */
+    ConditionVariableManager conditionVariableManager_;
+
+    /**
+     * @brief The spinlock sub-system manager.
+     */
+    SpinlockManager spinlockManager_;
+
+    /**
+     * @brief The barrier and latch sub-system manager.
+     */
+    BarrierManager barrierManager_;
+
+    /**
+     * @brief The event flags sub-system manager.
+     */
+    EventFlagsManager eventFlagsManager_;
+
+    /**
+     * @brief The queue sub-system manager.
+     */
+    QueueManager queueManager_;
+
 };
 
 } // namespace sys
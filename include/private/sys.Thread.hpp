@@ -9,6 +9,10 @@
 #include "sys.NonCopyable.hpp"
 #include "api.Thread.hpp"
 #include "api.Task.hpp"
+#include "sys.Callable.hpp"
+#include "sys.CancellationToken.hpp"
+#include "sys.ThreadRegistry.hpp"
+#include "sys.Clock.hpp"
 
 namespace eoos
 {
@@ -18,6 +22,14 @@ namespace sys
 /**
  * @class Thread
  * @brief Thread class.
+ *
+ * The thread is stopped cooperatively: its task polls or waits on the cancellation token of the thread,
+ * which is got by CancellationToken::getCurrent(), and returns when the cancellation is requested.
+ *
+ * The token, the registry node and the task are kept in a control block placed in the thread object
+ * and shared with the thread routine, so a thread allocates no memory but the object. If a thread has not
+ * returned on the cancellation request when its object is deleted, the memory of the object is kept,
+ * and it is freed by the last of the delete operator and the thread routine.
  * 
  * @tparam A Heap memory allocator class.
  */
@@ -35,8 +47,22 @@ public:
      */
     Thread(api::Task& task);
 
+    /**
+     * @brief Constructor of a thread which calls a callable object kept in its control block.
+     *
+     * @param function  A callable object which is called without arguments when this thread is started.
+     * @param stackSize Stack size of the thread, or zero for the default size.
+     * @tparam F Type of the callable object.
+     */
+    template <class F>
+    Thread(F const& function, size_t stackSize);
+
     /**
      * @brief Destructor.
+     *
+     * The cancellation of a running thread is requested, and the thread is waited to return
+     * for EOOS_GLOBAL_SYS_THREAD_STOP_TIMEOUT milliseconds, which the caller is blocked for
+     * if the thread does not return. Then the thread is detached.
      */
     virtual ~Thread();
 
@@ -55,6 +81,54 @@ public:
      */
     virtual bool_t join();
 
+    /**
+     * @brief Waits for this thread to die for a time.
+     *
+     * @param ms A time to wait in milliseconds.
+     * @return True if the thread has died, false if timed out or an error occurred.
+     */
+    bool_t join(int32_t ms);
+
+    /**
+     * @brief Waits for this thread to die until a deadline.
+     *
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock.
+     * @return True if the thread has died, false if timed out or an error occurred.
+     */
+    bool_t joinUntil(::timespec const& deadline);
+
+    /**
+     * @brief Requests cancellation of this thread.
+     *
+     * @return True if the cancellation has been requested.
+     */
+    bool_t cancel();
+
+    /**
+     * @brief Returns the cancellation token of this thread.
+     *
+     * @return The cancellation token.
+     */
+    CancellationToken& getToken();
+
+    /**
+     * @brief Sets a name of this thread.
+     *
+     * @param name A name, which is truncated to ThreadStatistics::NAME_LENGTH - 1 characters.
+     * @return True if the name has been set.
+     */
+    bool_t setName(char_t const* name);
+
+    /**
+     * @brief Lists this thread in a registry until it is destroyed.
+     *
+     * @note The registry shall be set before the thread is executed.
+     *
+     * @param registry A registry.
+     * @return True if the thread has been listed.
+     */
+    bool_t setRegistry(ThreadRegistry& registry);
+
     /**
      * @copydoc eoos::api::Thread::getPriority()
      */
@@ -65,12 +139,96 @@ public:
      */
     virtual bool_t setPriority(int32_t priority);
 
+    /**
+     * @brief Frees memory of a thread object, or keeps it for the routine of a thread which has not returned.
+     *
+     * @param ptr Address of the memory.
+     */
+    static void operator delete(void* ptr);
+
 protected:
 
     using Parent::setConstructed;
 
 private:
 
+    /**
+     * @struct Control
+     * @brief Control block of a thread shared by the thread object and the thread routine.
+     */
+    struct Control
+    {
+        /**
+         * @brief Constructor of a block of a task.
+         *
+         * @param task A task interface whose main method is invoked when the thread is started.
+         */
+        explicit Control(api::Task& task);
+
+        /**
+         * @brief Constructor of a block of a callable object kept in the block.
+         *
+         * @param function  A callable object which is called without arguments when the thread is started.
+         * @param stackSize Stack size of the thread, or zero for the default size.
+         * @tparam F Type of the callable object.
+         */
+        template <class F>
+        Control(F const& function, size_t stackSize);
+
+        /**
+         * @brief Cancellation token of the thread.
+         */
+        CancellationToken token; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Node of the thread in a registry.
+         */
+        ThreadRegistry::Node node; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Task of a callable object kept in the block.
+         */
+        Callable callable; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief User executing runnable interface.
+         */
+        api::Task* task; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Registry the thread is listed in, or NULLPTR.
+         */
+        ThreadRegistry* registry; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Number of the thread object and the thread routine which refer to the block.
+         */
+        int32_t references; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Memory of a deleted thread object the block is placed in, which is freed with the block, or NULLPTR.
+         */
+        void* memory; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Operator new for the block placed in a thread object.
+         *
+         * @param size Number of bytes to allocate.
+         * @param ptr  Memory the block is placed in.
+         * @return The memory.
+         */
+        static void* operator new(size_t size, void* ptr);
+
+        /**
+         * @brief Operator delete for the block placed in a thread object.
+         *
+         * @param ptr   Address of the block.
+         * @param place Memory the block is placed in.
+         */
+        static void operator delete(void* ptr, void* place);
+
+    };
+
     /**
      * @brief Constructor.
      *
@@ -85,6 +243,13 @@ private:
      */
     static void* start(void* argument);
 
+    /**
+     * @brief Drops a reference to a control block, and destroys the block if it is the last one.
+     *
+     * @param control A control block, which memory of a deleted thread object is freed with.
+     */
+    static void release(Control* control);
+
     /**
      * @struct The pthread attr container for the pthread_create function
      * @brief The struct implements RAII approach on pthread_attr_t.
@@ -109,9 +274,14 @@ private:
     };    
     
     /**
-     * @brief User executing runnable interface.
+     * @brief Memory of the control block of this thread.
      */
-    api::Task* task_;
+    uint64_t memory_[ (sizeof(Control) + sizeof(uint64_t) - 1U) / sizeof(uint64_t) ] __attribute__((aligned(__alignof__(Control))));
+
+    /**
+     * @brief Control block of this thread placed in its memory.
+     */
+    Control* control_;
 
     /**
      * @brief Current status.
@@ -128,13 +298,36 @@ private:
      */
     ::pthread_t thread_;    
 
+    /**
+     * @brief Control block of a thread object being deleted which memory is kept for its routine, or NULLPTR.
+     */
+    static __thread Control* retained_;
+
 };
 
+template <class A>
+__thread typename Thread<A>::Control* Thread<A>::retained_( NULLPTR );
+
 template <class A>
 Thread<A>::Thread(api::Task& task) 
     : NonCopyable<A>()
     , api::Thread()
-    , task_ (&task)
+    , memory_ ()
+    , control_ ( new (memory_) Control(task) )
+    , status_ (STATUS_NEW)
+    , priority_ (PRIORITY_NORM)
+    , thread_ (0) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+template <class F>
+Thread<A>::Thread(F const& function, size_t const stackSize) 
+    : NonCopyable<A>()
+    , api::Thread()
+    , memory_ ()
+    , control_ ( new (memory_) Control(function, stackSize) )
     , status_ (STATUS_NEW)
     , priority_ (PRIORITY_NORM)
     , thread_ (0) {
@@ -145,14 +338,33 @@ Thread<A>::Thread(api::Task& task)
 template <class A>
 Thread<A>::~Thread()
 {
-    if( thread_ != 0U )
+    bool_t isRetained( false );
+    if( status_ == STATUS_RUNNABLE )
     {
-        // @todo The thread detaching means the thread will still be executed by OS.
-        // Thus, to keep compatibility, common approach for all OSs shall be found
-        // for using pthread_cancel function to cancel the thread execution forcely.
-        static_cast<void>( ::pthread_detach(thread_) );
+        control_->token.cancel();
+        if( !join(EOOS_GLOBAL_SYS_THREAD_STOP_TIMEOUT) )
+        {
+            // The thread which has not returned on the cancellation request is still executed by OS
+            static_cast<void>( ::pthread_detach(thread_) );
+            isRetained = true;
+        }
         status_ = STATUS_DEAD;            
     }
+    if( control_->registry != NULLPTR )
+    {
+        static_cast<void>( control_->registry->remove(&control_->node) );
+    }
+    if( isRetained )
+    {
+        // The routine keeps referring to the control block, so the block and the memory of this object
+        // are passed to the delete operator, which leaves them to be freed by the routine on return
+        control_->memory = this;
+        retained_ = control_;
+    }
+    else
+    {
+        release(control_);
+    }
 }
 
 template <class A>
@@ -169,19 +381,42 @@ bool_t Thread<A>::execute()
     {
         int_t error( 0 );
         PthreadAttr pthreadAttr; ///< SCA MISRA-C++:2008 Justified Rule 9-5-1
-        size_t const stackSize( task_->getStackSize() );
+        ThreadRegistry* const registry( control_->registry );
+        size_t const stackSize( control_->task->getStackSize() );
         if(stackSize != 0U)
         {
             error = ::pthread_attr_setstacksize(&pthreadAttr.attr, stackSize);
         }
         if(error == 0)
         {
-            error = ::pthread_create(&thread_, &pthreadAttr.attr, &start, &task_);
+            if( registry != NULLPTR )
+            {
+                error = registry->start(&control_->node) ? 0 : EAGAIN;
+            }
+        }
+        if(error == 0)
+        {
+            // The reference of the thread routine is taken before the routine might drop it
+            control_->references = 2;
+            error = ::pthread_create(&thread_, &pthreadAttr.attr, &start, control_);
             if(error == 0)
             {            
+                if( control_->node.name[0] != '\0' )
+                {
+                    static_cast<void>( ::pthread_setname_np(thread_, control_->node.name) );
+                }
                 status_ = STATUS_RUNNABLE;
                 res = true;
             }
+            else
+            {
+                control_->references = 1;
+                if( registry != NULLPTR )
+                {
+                    static_cast<void>( registry->finish(&control_->node) );
+                    registry->leave();
+                }
+            }
         }
     }
     return res;        
@@ -200,6 +435,91 @@ bool_t Thread<A>::join()
     return res;
 }
 
+template <class A>
+bool_t Thread<A>::join(int32_t const ms)
+{
+    bool_t res( false );
+    ::timespec deadline;
+    if( Clock::getDeadline(ms, deadline) )
+    {
+        res = joinUntil(deadline);
+    }
+    return res;
+}
+
+template <class A>
+bool_t Thread<A>::joinUntil(::timespec const& deadline)
+{
+    bool_t res( false );    
+    if( isConstructed() && (status_ == STATUS_RUNNABLE) )
+    {
+        int_t const error( ::pthread_clockjoin_np(thread_, NULL, CLOCK_MONOTONIC, &deadline) );
+        if( error == 0 )
+        {
+            status_ = STATUS_DEAD;
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t Thread<A>::cancel()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        control_->token.cancel();
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+CancellationToken& Thread<A>::getToken()
+{
+    return control_->token;
+}
+
+template <class A>
+bool_t Thread<A>::setName(char_t const* const name)
+{
+    bool_t res( false );
+    if( isConstructed() && (name != NULLPTR) )
+    {
+        if( control_->registry != NULLPTR )
+        {
+            res = control_->registry->setName(control_->node, name);
+        }
+        else
+        {
+            ThreadRegistry::copyName(control_->node, name);
+            res = true;
+        }
+        if( res && (status_ == STATUS_RUNNABLE) )
+        {
+            int_t const error( ::pthread_setname_np(thread_, control_->node.name) );
+            res = (error == 0) ? true : false;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t Thread<A>::setRegistry(ThreadRegistry& registry)
+{
+    bool_t res( false );
+    if( isConstructed() && (status_ == STATUS_NEW) && (control_->registry == NULLPTR) )
+    {
+        res = registry.add(control_->node);
+        if( res )
+        {
+            control_->registry = &registry;
+        }
+    }
+    return res;
+}
+
 template <class A>
 int32_t Thread<A>::getPriority() const
 {
@@ -226,17 +546,40 @@ bool_t Thread<A>::setPriority(int32_t priority)
         {
             res = false;
         }
+        if( res )
+        {
+            // The priority is read by the registry snapshots
+            __atomic_store_n(&control_->node.priority, priority, __ATOMIC_RELAXED);
+        }
     }
     // @todo Implemet setting priority on system level regarding common API rage
     return res;
 }
 
+template <class A>
+void Thread<A>::operator delete(void* const ptr)
+{
+    Control* const control( retained_ );
+    if( (control != NULLPTR) && (control->memory == ptr) )
+    {
+        retained_ = NULLPTR;
+        release(control);
+    }
+    else
+    {
+        A::free(ptr);
+    }
+}
+
 template <class A>
 bool_t Thread<A>::construct()
 {
     bool_t res( false );
-    if( isConstructed() && Parent::isConstructed(task_) )
+    if( isConstructed() && Parent::isConstructed(control_->task) )
     {
+        control_->node.token = &control_->token;
+        control_->node.priority = priority_;
+        ThreadRegistry::copyName(control_->node, NULLPTR);
         status_ = STATUS_NEW;
         res = true;
     }
@@ -252,36 +595,95 @@ void* Thread<A>::start(void* argument)
 {
     if(argument != NULLPTR) 
     {
-        api::Task** addr( reinterpret_cast<api::Task**>(argument) );
-        if( addr != NULLPTR )
+        Control* const control( reinterpret_cast<Control*>(argument) );
+        ThreadRegistry* const registry( control->registry );
+        api::Task* const task( control->task ); ///< SCA MISRA-C++:2008 Justified Rule 5-2-8
+        __atomic_store_n(&control->node.tid, static_cast<int32_t>( ::syscall(SYS_gettid) ), __ATOMIC_RELEASE);
+        if( Parent::isConstructed(task) )
         {
-            api::Task* const task( *addr ); ///< SCA MISRA-C++:2008 Justified Rule 5-2-8
-            if( Parent::isConstructed(task) )
+            int_t oldstate;
+            // The thread is stopped by its cancellation token. The POSIX cancellation,
+            // which might leave locks held and memory leaked, is disabled.
+            int_t const error( ::pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &oldstate) );
+            if(error == 0)
             {
-                int_t oldtype;
-                // The thread is cancelable.  This is the default
-                // cancelability state in all new threads, including the
-                // initial thread.  The thread's cancelability type
-                // determines when a cancelable thread will respond to a
-                // cancellation request.
-                int_t error( ::pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, &oldtype) );
-                if(error == 0)
-                {
-                    // The thread can be canceled at any time. Typically, it
-                    // will be canceled immediately upon receiving a cancellation
-                    // request, but the system doesn't guarantee this.
-                    error = ::pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, &oldtype);
-                    if(error == 0)
-                    {
-                        task->start();
-                    }
-                }
+                CancellationToken::setCurrent(&control->token);
+                task->start();
+                CancellationToken::setCurrent(NULLPTR);
+            }
+        }
+        if( registry == NULLPTR )
+        {
+            release(control);
+        }
+        else if( ThreadRegistry::lock() )
+        {
+            // The registry is destroyed with the system, which does not wait for the threads not returned in time.
+            // Then the control block is not released, as the memory it is freed to has been destroyed too.
+            if( control->node.registry != NULLPTR )
+            {
+                static_cast<void>( registry->finish(&control->node) );
+                release(control);
+                registry->leave();
             }
+            ThreadRegistry::unlock();
+        }
+        else
+        {
+            // The registries cannot be locked, so the control block is left to be sure its memory is valid
         }
     }
     return NULLPTR;
 }
 
+template <class A>
+void Thread<A>::release(Control* const control)
+{
+    if( __atomic_sub_fetch(&control->references, 1, __ATOMIC_ACQ_REL) == 0 )
+    {
+        void* const memory( control->memory );
+        control->~Control();
+        if( memory != NULLPTR )
+        {
+            A::free(memory);
+        }
+    }
+}
+
+template <class A>
+Thread<A>::Control::Control(api::Task& task)
+    : token()
+    , node()
+    , callable()
+    , task(&task)
+    , registry(NULLPTR)
+    , references(1)
+    , memory(NULLPTR) {
+}
+
+template <class A>
+template <class F>
+Thread<A>::Control::Control(F const& function, size_t const stackSize)
+    : token()
+    , node()
+    , callable(function, stackSize)
+    , task(&callable)
+    , registry(NULLPTR)
+    , references(1)
+    , memory(NULLPTR) {
+}
+
+template <class A>
+void* Thread<A>::Control::operator new(size_t, void* const ptr)
+{
+    return ptr;
+}
+
+template <class A>
+void Thread<A>::Control::operator delete(void*, void*)
+{
+}
+
 template <class A>
 Thread<A>::PthreadAttr::PthreadAttr()
 {
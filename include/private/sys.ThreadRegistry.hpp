@@ -0,0 +1,353 @@
+/**
+ * @file      sys.ThreadRegistry.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADREGISTRY_HPP_
+#define SYS_THREADREGISTRY_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.NoAllocator.hpp"
+#include "sys.CancellationToken.hpp"
+#include "api.Thread.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @struct ThreadStatistics
+ * @brief Statistics of a thread.
+ *
+ * The fields got from the OS are -1, and the affinity is zero, if the thread is not running,
+ * it exits while the statistics are taken, or the OS does not provide them.
+ */
+struct ThreadStatistics
+{
+    /**
+     * @brief Maximum length of a thread name including the terminating null character.
+     */
+    static const int32_t NAME_LENGTH = 16;
+
+    /**
+     * @brief Name of the thread.
+     */
+    char_t name[NAME_LENGTH];
+
+    /**
+     * @brief Status of the thread.
+     */
+    api::Thread::Status status;
+
+    /**
+     * @brief Kernel thread identifier.
+     */
+    int32_t tid;
+
+    /**
+     * @brief Priority of the thread.
+     */
+    int32_t priority;
+
+    /**
+     * @brief CPU affinity mask of the first 64 CPUs.
+     */
+    uint64_t affinity;
+
+    /**
+     * @brief CPU the thread was last executed on.
+     */
+    int32_t cpu;
+
+    /**
+     * @brief CPU time consumed in nanoseconds.
+     */
+    int64_t cpuTime;
+
+    /**
+     * @brief Time spent on a run queue waiting for a CPU in nanoseconds.
+     */
+    int64_t waitTime;
+
+    /**
+     * @brief Number of context switches as the thread blocked.
+     */
+    int64_t voluntarySwitches;
+
+    /**
+     * @brief Number of context switches as the thread was preempted.
+     */
+    int64_t involuntarySwitches;
+
+    /**
+     * @brief Number of migrations of the thread between CPUs.
+     */
+    int64_t migrations;
+
+};
+
+/**
+ * @class ThreadRegistry
+ * @brief Registry of live threads which are stopped together.
+ *
+ * A thread is listed from its creation until its destruction, and it is running from its execution
+ * until its routine leaves the registry. A thread destroyed while it is running is unlisted when its
+ * routine returns. Stopping the registry requests cancellation of all running threads and waits for
+ * their routines to return. A routine which returns after the registry has been destroyed does not
+ * access the registry, as the registry detaches the nodes of the listed threads on destruction.
+ */
+class ThreadRegistry : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @struct Node
+     * @brief Registry node kept in a control block of a thread.
+     */
+    struct Node
+    {
+        /**
+         * @brief Previous node.
+         */
+        Node* prev; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Next node.
+         */
+        Node* next; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Registry the node is listed in, or NULLPTR if the registry has been destroyed.
+         */
+        ThreadRegistry* registry; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Cancellation token of the thread.
+         */
+        CancellationToken* token; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Status of the thread.
+         */
+        api::Thread::Status status; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Priority of the thread.
+         */
+        int32_t priority; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Kernel thread identifier which is set by the thread, or zero.
+         */
+        int32_t tid; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief True if the thread has been destroyed while it is running.
+         */
+        bool_t isRemoved; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+        /**
+         * @brief Name of the thread.
+         */
+        char_t name[ThreadStatistics::NAME_LENGTH]; ///< SCA MISRA-C++:2008 Justified Rule 11-0-1
+
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    ThreadRegistry();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ThreadRegistry();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Lists a new thread.
+     *
+     * @param node A node of the thread.
+     * @return True if the thread has been listed.
+     */
+    bool_t add(Node& node);
+
+    /**
+     * @brief Unlists a thread, or marks a running thread to be unlisted when its routine returns.
+     *
+     * @note A running thread is still counted until its routine leaves the registry.
+     *
+     * @param node A node of the thread.
+     * @return True if the thread has been unlisted.
+     */
+    bool_t remove(Node* node);
+
+    /**
+     * @brief Marks a thread running before it is executed.
+     *
+     * @param node A node of the thread.
+     * @return True if the thread is listed and has been marked.
+     */
+    bool_t start(Node* node);
+
+    /**
+     * @brief Marks a thread dead when its routine returns, and unlists it if it has been destroyed.
+     *
+     * @param node A node of the thread.
+     * @return True if the thread has been marked.
+     */
+    bool_t finish(Node* node);
+
+    /**
+     * @brief Counts out a running thread which routine does not access the thread resources anymore.
+     *
+     * @note This is the last access of the routine to the registry.
+     */
+    void leave();
+
+    /**
+     * @brief Sets a name of a thread.
+     *
+     * @param node A node of the thread.
+     * @param name A name, which is truncated to ThreadStatistics::NAME_LENGTH - 1 characters.
+     * @return True if the name has been set.
+     */
+    bool_t setName(Node& node, char_t const* name);
+
+    /**
+     * @brief Stops all running threads.
+     *
+     * @param deadline Absolute time of CLOCK_MONOTONIC clock.
+     * @return True if all the threads have returned before the deadline.
+     */
+    bool_t stop(::timespec const& deadline);
+
+    /**
+     * @brief Takes a snapshot of statistics of the listed threads.
+     *
+     * @param statistics An array the statistics are copied to.
+     * @param length     Number of elements of the array.
+     * @return Number of the listed threads, which might exceed the array length, or -1 if an error occurred.
+     */
+    int32_t getStatistics(ThreadStatistics* statistics, int32_t length);
+
+    /**
+     * @brief Locks the registries from destruction.
+     *
+     * A returning routine locks the registries to access the registry of its node,
+     * which is NULLPTR if the registry has been destroyed.
+     *
+     * @return True if the registries are locked.
+     */
+    static bool_t lock();
+
+    /**
+     * @brief Unlocks the registries.
+     */
+    static void unlock();
+
+    /**
+     * @brief Copies a name to a node.
+     *
+     * @param node A node.
+     * @param name A name, which is truncated to ThreadStatistics::NAME_LENGTH - 1 characters.
+     */
+    static void copyName(Node& node, char_t const* name);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Unlinks a listed node.
+     *
+     * @param node A listed node.
+     */
+    void unlink(Node* node);
+
+    /**
+     * @brief Finds a listed node.
+     *
+     * @param node A node.
+     * @return The node, or NULLPTR if it is not listed.
+     */
+    Node* find(Node const* node) const;
+
+    /**
+     * @brief Copies statistics of a thread kept in its node.
+     *
+     * @param node       A listed node.
+     * @param statistics Statistics, which tid is -1 if the thread is not running.
+     */
+    static void copy(Node const& node, ThreadStatistics& statistics);
+
+    /**
+     * @brief Collects statistics of a thread got from the OS by its kernel identifier.
+     *
+     * @note The list is not locked, so the thread might exit, and then the reads fail.
+     *
+     * @param statistics Statistics with the copied kernel thread identifier.
+     */
+    static void collect(ThreadStatistics& statistics);
+
+    /**
+     * @brief Reads a file of a thread from the proc file system.
+     *
+     * @param tid    Kernel thread identifier.
+     * @param file   Name of the file.
+     * @param buffer A buffer the file is read to as a null terminated string.
+     * @param size   Size of the buffer.
+     * @return True if the file has been read.
+     */
+    static bool_t readFile(int32_t tid, char_t const* file, char_t* buffer, size_t size);
+
+    /**
+     * @brief Finds a number of a key in a text of key and number lines.
+     *
+     * @param text A text.
+     * @param key  A key with the preceding new line character.
+     * @return The number, or -1 if the key is not found.
+     */
+    static int64_t findNumber(char_t const* text, char_t const* key);
+
+    /**
+     * @brief Mutex of returning routines and destroyed registries, which outlives the registries.
+     */
+    static ::pthread_mutex_t exit_;
+
+    /**
+     * @brief Mutex of the list.
+     */
+    ::pthread_mutex_t mutex_;
+
+    /**
+     * @brief First node of the list.
+     */
+    Node* head_;
+
+    /**
+     * @brief Number of running threads which have not left as futex word.
+     */
+    int32_t running_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADREGISTRY_HPP_
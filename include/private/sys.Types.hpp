@@ -16,6 +16,15 @@
 #include <new>
 #endif // EOOS_CPP_STANDARD >= 2011
 
+/**
+ * @brief Specifier of classes which cannot be derived, so calls of their virtual functions can be devirtualized.
+ */
+#if EOOS_CPP_STANDARD >= 2011
+    #define EOOS_SYS_FINAL final
+#else
+    #define EOOS_SYS_FINAL
+#endif // EOOS_CPP_STANDARD >= 2011
+
 namespace eoos
 {
 namespace sys
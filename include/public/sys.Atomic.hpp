@@ -0,0 +1,250 @@
+/**
+ * @file      sys.Atomic.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_ATOMIC_HPP_
+#define SYS_ATOMIC_HPP_
+
+#include "lib.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @enum MemoryOrder
+ * @brief Memory orders of atomic operations.
+ */
+enum MemoryOrder
+{
+    MEMORY_ORDER_RELAXED = __ATOMIC_RELAXED, ///< No ordering, only atomicity.
+    MEMORY_ORDER_ACQUIRE = __ATOMIC_ACQUIRE, ///< Later accesses are not moved before a load.
+    MEMORY_ORDER_RELEASE = __ATOMIC_RELEASE, ///< Earlier accesses are not moved after a store.
+    MEMORY_ORDER_ACQ_REL = __ATOMIC_ACQ_REL, ///< Both acquire and release for read-modify-write operations.
+    MEMORY_ORDER_SEQ_CST = __ATOMIC_SEQ_CST  ///< Acquire and release in a single total order of all such operations.
+};
+
+/**
+ * @class Atomic
+ * @brief Atomic variable class.
+ *
+ * The operations are the GCC and Clang atomic builtins, which are lock-free for integer and pointer
+ * types of the native word size and smaller.
+ *
+ * @note A load shall not be of release orders, a store shall not be of acquire orders, and a failure
+ *       order of compare-and-exchange operations shall not be release orders or stronger than the success order.
+ *
+ * @tparam T Integer or pointer type.
+ */
+template <typename T>
+class Atomic
+{
+
+public:
+
+    /**
+     * @brief Constructor of a zero value.
+     */
+    Atomic();
+
+    /**
+     * @brief Constructor.
+     *
+     * @param value The initial value.
+     */
+    explicit Atomic(T value);
+
+    /**
+     * @brief Destructor.
+     */
+    ~Atomic();
+
+    /**
+     * @brief Loads the value.
+     *
+     * @param order Memory order.
+     * @return The value.
+     */
+    T load(MemoryOrder order = MEMORY_ORDER_SEQ_CST) const;
+
+    /**
+     * @brief Stores a value.
+     *
+     * @param value A value.
+     * @param order Memory order.
+     */
+    void store(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST);
+
+    /**
+     * @brief Replaces the value.
+     *
+     * @param value A new value.
+     * @param order Memory order.
+     * @return The previous value.
+     */
+    T exchange(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST);
+
+    /**
+     * @brief Replaces the value if it equals an expected value.
+     *
+     * @param expected An expected value, which is set to the actual value if they are not equal.
+     * @param desired  A new value.
+     * @param success  Memory order if the value is replaced.
+     * @param failure  Memory order if the value is not replaced.
+     * @return True if the value has been replaced.
+     */
+    bool_t compareExchange(T& expected, T desired, MemoryOrder success = MEMORY_ORDER_SEQ_CST, MemoryOrder failure = MEMORY_ORDER_SEQ_CST);
+
+    /**
+     * @brief Replaces the value if it equals an expected value, or might fail spuriously.
+     *
+     * @note The function is cheaper than compareExchange on some CPUs if it is called in a loop.
+     *
+     * @param expected An expected value, which is set to the actual value if the value is not replaced.
+     * @param desired  A new value.
+     * @param success  Memory order if the value is replaced.
+     * @param failure  Memory order if the value is not replaced.
+     * @return True if the value has been replaced.
+     */
+    bool_t compareExchangeWeak(T& expected, T desired, MemoryOrder success = MEMORY_ORDER_SEQ_CST, MemoryOrder failure = MEMORY_ORDER_SEQ_CST);
+
+    /**
+     * @brief Adds a number to the value.
+     *
+     * @note The function is for integer types only.
+     *
+     * @param value A number.
+     * @param order Memory order.
+     * @return The previous value.
+     */
+    T fetchAdd(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST);
+
+    /**
+     * @brief Subtracts a number from the value.
+     *
+     * @note The function is for integer types only.
+     *
+     * @param value A number.
+     * @param order Memory order.
+     * @return The previous value.
+     */
+    T fetchSub(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST);
+
+private:
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    Atomic(Atomic const&); ///< SCA MISRA-C++:2008 Justified Rule 3-2-2 and Rule 3-2-4
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    Atomic& operator=(Atomic const&); ///< SCA MISRA-C++:2008 Justified Rule 3-2-2 and Rule 3-2-4
+
+    /**
+     * @brief The value.
+     */
+    T value_;
+
+};
+
+/**
+ * @class Fence
+ * @brief Memory fences.
+ */
+class Fence
+{
+
+public:
+
+    /**
+     * @brief Orders memory accesses of the caller thread with accesses of other threads.
+     *
+     * @param order Memory order.
+     */
+    static void thread(MemoryOrder order);
+
+    /**
+     * @brief Orders memory accesses of the caller thread with a signal handler executed on the thread.
+     *
+     * @note Only the compiler is prevented from reordering the accesses.
+     *
+     * @param order Memory order.
+     */
+    static void signal(MemoryOrder order);
+
+};
+
+template <typename T>
+inline Atomic<T>::Atomic()
+    : value_(0) {
+}
+
+template <typename T>
+inline Atomic<T>::Atomic(T const value)
+    : value_(value) {
+}
+
+template <typename T>
+inline Atomic<T>::~Atomic()
+{
+}
+
+template <typename T>
+inline T Atomic<T>::load(MemoryOrder const order) const
+{
+    return __atomic_load_n(&value_, static_cast<int>(order));
+}
+
+template <typename T>
+inline void Atomic<T>::store(T const value, MemoryOrder const order)
+{
+    __atomic_store_n(&value_, value, static_cast<int>(order));
+}
+
+template <typename T>
+inline T Atomic<T>::exchange(T const value, MemoryOrder const order)
+{
+    return __atomic_exchange_n(&value_, value, static_cast<int>(order));
+}
+
+template <typename T>
+inline bool_t Atomic<T>::compareExchange(T& expected, T const desired, MemoryOrder const success, MemoryOrder const failure)
+{
+    return __atomic_compare_exchange_n(&value_, &expected, desired, false, static_cast<int>(success), static_cast<int>(failure));
+}
+
+template <typename T>
+inline bool_t Atomic<T>::compareExchangeWeak(T& expected, T const desired, MemoryOrder const success, MemoryOrder const failure)
+{
+    return __atomic_compare_exchange_n(&value_, &expected, desired, true, static_cast<int>(success), static_cast<int>(failure));
+}
+
+template <typename T>
+inline T Atomic<T>::fetchAdd(T const value, MemoryOrder const order)
+{
+    return __atomic_fetch_add(&value_, value, static_cast<int>(order));
+}
+
+template <typename T>
+inline T Atomic<T>::fetchSub(T const value, MemoryOrder const order)
+{
+    return __atomic_fetch_sub(&value_, value, static_cast<int>(order));
+}
+
+inline void Fence::thread(MemoryOrder const order)
+{
+    __atomic_thread_fence(static_cast<int>(order));
+}
+
+inline void Fence::signal(MemoryOrder const order)
+{
+    __atomic_signal_fence(static_cast<int>(order));
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_ATOMIC_HPP_
@@ -0,0 +1,134 @@
+/**
+ * @file      sys.BarrierManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.BarrierManager.hpp"
+#include "lib.UniquePointer.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+api::Heap* BarrierManager::resource_( NULLPTR );
+
+BarrierManager::BarrierManager() 
+    : NonCopyable<NoAllocator>()
+    , pool_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+BarrierManager::~BarrierManager()
+{
+    BarrierManager::deinitialize();
+}
+
+bool_t BarrierManager::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+Barrier<BarrierManager>* BarrierManager::createBarrier(int32_t const parties)
+{
+    BarrierResource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<BarrierResource> res( new BarrierResource(parties) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }    
+    return ptr;
+}
+
+Latch<BarrierManager>* BarrierManager::createLatch(int32_t const count)
+{
+    LatchResource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<LatchResource> res( new LatchResource(count) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }    
+    return ptr;
+}
+
+bool_t BarrierManager::getStatistics(ResourceStatistics& statistics) const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = pool_.memory.getStatistics(statistics);
+    }
+    return res;
+}
+
+bool_t BarrierManager::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( pool_.memory.isConstructed() )
+        {
+            if( initialize(&pool_.memory) )
+            {
+                res = true;
+            }
+        }
+    }
+    return res;
+}
+
+void* BarrierManager::allocate(size_t size)
+{
+    void* addr( NULLPTR );
+    if( resource_ != NULLPTR )
+    {
+        addr = resource_->allocate(size, NULLPTR);
+    }
+    return addr;
+}
+
+void BarrierManager::free(void* ptr)
+{
+    if( resource_ != NULLPTR )
+    {
+        resource_->free(ptr);
+    }
+}
+
+bool_t BarrierManager::initialize(api::Heap* resource)
+{
+    bool_t res( false );
+    if( resource_ == NULLPTR )
+    {
+        resource_ = resource;
+        res = true;
+    }
+    return res;
+}
+
+void BarrierManager::deinitialize()
+{
+    resource_ = NULLPTR;
+}
+
+BarrierManager::ResourcePool::ResourcePool()
+    : memory("EOOS_SYS_NUMBER_OF_BARRIERS") {
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,50 @@
+/**
+ * @file      sys.Callable.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.Callable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+Callable::Callable()
+    : NonCopyable<NoAllocator>()
+    , api::Task()
+    , buffer_()
+    , invoke_(NULLPTR)
+    , destroy_(NULLPTR)
+    , stackSize_(0U) {
+    setConstructed( false );
+}
+
+Callable::~Callable()
+{
+    if( destroy_ != NULLPTR )
+    {
+        destroy_(buffer_);
+    }
+}
+
+bool_t Callable::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+void Callable::start()
+{
+    if( isConstructed() )
+    {
+        invoke_(buffer_);
+    }
+}
+
+size_t Callable::getStackSize() const
+{
+    return stackSize_;
+}
+
+} // namespace sys
+} // namespace eoos
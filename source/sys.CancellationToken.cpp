@@ -0,0 +1,84 @@
+/**
+ * @file      sys.CancellationToken.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.CancellationToken.hpp"
+#include "sys.Futex.hpp"
+#include "sys.Clock.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+__thread CancellationToken* CancellationToken::current_( NULLPTR );
+
+CancellationToken::CancellationToken()
+    : NonCopyable<NoAllocator>()
+    , isCancelled_(0) {
+}
+
+CancellationToken::~CancellationToken()
+{
+}
+
+void CancellationToken::cancel()
+{
+    if( __atomic_exchange_n(&isCancelled_, 1, __ATOMIC_SEQ_CST) == 0 )
+    {
+        static_cast<void>( Futex::wake(&isCancelled_, INT_MAX) );
+    }
+}
+
+bool_t CancellationToken::isCancelled() const
+{
+    return __atomic_load_n(&isCancelled_, __ATOMIC_ACQUIRE) != 0;
+}
+
+void CancellationToken::wait()
+{
+    while( !isCancelled() )
+    {
+        static_cast<void>( Futex::wait(&isCancelled_, 0) );
+    }
+}
+
+bool_t CancellationToken::wait(int32_t const ms)
+{
+    bool_t res( false );
+    ::timespec deadline;
+    if( Clock::getDeadline(ms, deadline) )
+    {
+        res = waitUntil(deadline);
+    }
+    return res;
+}
+
+bool_t CancellationToken::waitUntil(::timespec const& deadline)
+{
+    bool_t res( isCancelled() );
+    while( !res )
+    {
+        bool_t const isWoken( Futex::wait(&isCancelled_, 0, deadline) );
+        res = isCancelled();
+        if( !isWoken )
+        {
+            break;
+        }
+    }
+    return res;
+}
+
+CancellationToken* CancellationToken::getCurrent()
+{
+    return current_;
+}
+
+void CancellationToken::setCurrent(CancellationToken* const token)
+{
+    current_ = token;
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,64 @@
+/**
+ * @file      sys.Clock.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.Clock.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+bool_t Clock::getDeadline(int32_t const ms, ::timespec& deadline)
+{
+    bool_t res( false );
+    if( ms >= 0 )
+    {
+        int_t const error( ::clock_gettime(CLOCK_MONOTONIC, &deadline) );
+        if( error == 0 )
+        {
+            int64_t const nsec( static_cast<int64_t>(deadline.tv_nsec) + static_cast<int64_t>(ms % 1000) * 1000000 );
+            deadline.tv_sec += static_cast< ::time_t >(ms / 1000) + static_cast< ::time_t >(nsec / 1000000000);
+            deadline.tv_nsec = static_cast<long>(nsec % 1000000000); ///< SCA MISRA-C++:2008 Justified Rule 3-9-2
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool_t Clock::getDeadline(::timespec const& timeout, ::timespec& deadline)
+{
+    bool_t res( false );
+    if( (timeout.tv_sec >= 0) && (timeout.tv_nsec >= 0) && (timeout.tv_nsec < 1000000000) )
+    {
+        int_t const error( ::clock_gettime(CLOCK_MONOTONIC, &deadline) );
+        if( error == 0 )
+        {
+            deadline.tv_sec += timeout.tv_sec;
+            deadline.tv_nsec += timeout.tv_nsec;
+            if( deadline.tv_nsec >= 1000000000 )
+            {
+                deadline.tv_sec += 1;
+                deadline.tv_nsec -= 1000000000;
+            }
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool_t Clock::isExpired(::timespec const& deadline)
+{
+    bool_t res( true );
+    ::timespec now;
+    int_t const error( ::clock_gettime(CLOCK_MONOTONIC, &now) );
+    if( error == 0 )
+    {
+        res = (now.tv_sec > deadline.tv_sec) || ( (now.tv_sec == deadline.tv_sec) && (now.tv_nsec >= deadline.tv_nsec) );
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
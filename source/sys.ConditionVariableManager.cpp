@@ -0,0 +1,116 @@
+/**
+ * @file      sys.ConditionVariableManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.ConditionVariableManager.hpp"
+#include "lib.UniquePointer.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+api::Heap* ConditionVariableManager::resource_( NULLPTR );
+
+ConditionVariableManager::ConditionVariableManager() 
+    : NonCopyable<NoAllocator>()
+    , pool_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+ConditionVariableManager::~ConditionVariableManager()
+{
+    ConditionVariableManager::deinitialize();
+}
+
+bool_t ConditionVariableManager::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+ConditionVariable<ConditionVariableManager>* ConditionVariableManager::create()
+{
+    Resource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<Resource> res( new Resource() );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }    
+    return ptr;
+}
+
+bool_t ConditionVariableManager::getStatistics(ResourceStatistics& statistics) const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = pool_.memory.getStatistics(statistics);
+    }
+    return res;
+}
+
+bool_t ConditionVariableManager::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( pool_.memory.isConstructed() )
+        {
+            if( initialize(&pool_.memory) )
+            {
+                res = true;
+            }
+        }
+    }
+    return res;
+}
+
+void* ConditionVariableManager::allocate(size_t size)
+{
+    void* addr( NULLPTR );
+    if( resource_ != NULLPTR )
+    {
+        addr = resource_->allocate(size, NULLPTR);
+    }
+    return addr;
+}
+
+void ConditionVariableManager::free(void* ptr)
+{
+    if( resource_ != NULLPTR )
+    {
+        resource_->free(ptr);
+    }
+}
+
+bool_t ConditionVariableManager::initialize(api::Heap* resource)
+{
+    bool_t res( false );
+    if( resource_ == NULLPTR )
+    {
+        resource_ = resource;
+        res = true;
+    }
+    return res;
+}
+
+void ConditionVariableManager::deinitialize()
+{
+    resource_ = NULLPTR;
+}
+
+ConditionVariableManager::ResourcePool::ResourcePool()
+    : memory("EOOS_SYS_NUMBER_OF_CONDITION_VARIABLES") {
+}
+
+} // namespace sys
+} // namespace eoos
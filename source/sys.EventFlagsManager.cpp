@@ -0,0 +1,116 @@
+/**
+ * @file      sys.EventFlagsManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.EventFlagsManager.hpp"
+#include "lib.UniquePointer.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+api::Heap* EventFlagsManager::resource_( NULLPTR );
+
+EventFlagsManager::EventFlagsManager() 
+    : NonCopyable<NoAllocator>()
+    , pool_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+EventFlagsManager::~EventFlagsManager()
+{
+    EventFlagsManager::deinitialize();
+}
+
+bool_t EventFlagsManager::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+EventFlags<EventFlagsManager>* EventFlagsManager::create(uint32_t const flags)
+{
+    Resource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<Resource> res( new Resource(flags) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }    
+    return ptr;
+}
+
+bool_t EventFlagsManager::getStatistics(ResourceStatistics& statistics) const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = pool_.memory.getStatistics(statistics);
+    }
+    return res;
+}
+
+bool_t EventFlagsManager::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( pool_.memory.isConstructed() )
+        {
+            if( initialize(&pool_.memory) )
+            {
+                res = true;
+            }
+        }
+    }
+    return res;
+}
+
+void* EventFlagsManager::allocate(size_t size)
+{
+    void* addr( NULLPTR );
+    if( resource_ != NULLPTR )
+    {
+        addr = resource_->allocate(size, NULLPTR);
+    }
+    return addr;
+}
+
+void EventFlagsManager::free(void* ptr)
+{
+    if( resource_ != NULLPTR )
+    {
+        resource_->free(ptr);
+    }
+}
+
+bool_t EventFlagsManager::initialize(api::Heap* resource)
+{
+    bool_t res( false );
+    if( resource_ == NULLPTR )
+    {
+        resource_ = resource;
+        res = true;
+    }
+    return res;
+}
+
+void EventFlagsManager::deinitialize()
+{
+    resource_ = NULLPTR;
+}
+
+EventFlagsManager::ResourcePool::ResourcePool()
+    : memory("EOOS_SYS_NUMBER_OF_EVENT_FLAGS") {
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,40 @@
+/**
+ * @file      sys.Futex.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.Futex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+bool_t Futex::wait(int32_t* const word, int32_t const value)
+{
+    long const error( ::syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0) ); ///< SCA MISRA-C++:2008 Justified Rule 3-9-2
+    return (error == 0) || (errno == EAGAIN) || (errno == EINTR);
+}
+
+bool_t Futex::wait(int32_t* const word, int32_t const value, ::timespec const& deadline)
+{
+    long const error( ::syscall(SYS_futex, word, FUTEX_WAIT_BITSET_PRIVATE, value, &deadline, NULL, FUTEX_BITSET_MATCH_ANY) ); ///< SCA MISRA-C++:2008 Justified Rule 3-9-2
+    return (error == 0) || (errno == EAGAIN) || (errno == EINTR);
+}
+
+int32_t Futex::wake(int32_t* const word, int32_t const count)
+{
+    long const number( ::syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0) ); ///< SCA MISRA-C++:2008 Justified Rule 3-9-2
+    return static_cast<int32_t>(number);
+}
+
+int32_t Futex::requeue(int32_t* const word, int32_t const value, int32_t const count, int32_t* const target)
+{
+    // The fourth argument of the call is the maximum number of threads to be moved
+    uintptr_t const limit( static_cast<uintptr_t>(INT_MAX) );
+    long const number( ::syscall(SYS_futex, word, FUTEX_CMP_REQUEUE_PRIVATE, count, limit, target, value) ); ///< SCA MISRA-C++:2008 Justified Rule 3-9-2
+    return static_cast<int32_t>(number);
+}
+
+} // namespace sys
+} // namespace eoos
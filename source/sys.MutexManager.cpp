@@ -31,12 +31,12 @@ bool_t MutexManager::isConstructed() const
     return Parent::isConstructed();
 }
 
-api::Mutex* MutexManager::create()
+MutexManager::Resource* MutexManager::create()
 {
-    api::Mutex* ptr( NULLPTR );
+    Resource* ptr( NULLPTR );
     if( isConstructed() )
     {
-        lib::UniquePointer<api::Mutex> res( new Resource() );
+        lib::UniquePointer<Resource> res( new Resource() );
         if( !res.isNull() )
         {
             if( !res->isConstructed() )
@@ -49,6 +49,86 @@ api::Mutex* MutexManager::create()
     return ptr;
 }
 
+MutexManager::Resource* MutexManager::create(Storage& storage)
+{
+    Resource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        Resource* const res( new (storage.memory) Resource() );
+        if( res->isConstructed() )
+        {
+            ptr = res;
+        }
+        else
+        {
+            res->~Resource();
+        }
+    }
+    return ptr;
+}
+
+void MutexManager::destroy(Storage& storage)
+{
+    void* const memory( storage.memory );
+    static_cast<Resource*>(memory)->~Resource();
+}
+
+MutexManager::Array* MutexManager::createArray(int32_t const length)
+{
+    Array* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<Array> res( Array::create(length) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+MutexManager::SharedResource* MutexManager::createShared(char_t const* const name)
+{
+    SharedResource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<SharedResource> res( new SharedResource(name) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+bool_t MutexManager::removeShared(char_t const* const name)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = SharedMemory::remove(name);
+    }
+    return res;
+}
+
+bool_t MutexManager::getStatistics(ResourceStatistics& statistics) const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = pool_.memory.getStatistics(statistics);
+    }
+    return res;
+}
+
 bool_t MutexManager::construct()
 {
     bool_t res( false );
@@ -100,8 +180,7 @@ void MutexManager::deinitialize()
 }
 
 MutexManager::ResourcePool::ResourcePool()
-    : mutex_()
-    , memory( mutex_ ) {
+    : memory("EOOS_SYS_NUMBER_OF_MUTEXS") {
 }
 
 } // namespace sys
@@ -0,0 +1,52 @@
+/**
+ * @file      sys.QueueEvent.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.QueueEvent.hpp"
+#include "sys.Futex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+QueueEvent::QueueEvent()
+    : NonCopyable<NoAllocator>()
+    , sequence_(0)
+    , waiters_(0) {
+}
+
+QueueEvent::~QueueEvent()
+{
+}
+
+void QueueEvent::signal()
+{
+    // The sequence is advanced before the waiters are read, and a waiter is counted before it reads
+    // the sequence, so either the signal sees the waiter or the waiter sees the new sequence
+    static_cast<void>( __atomic_add_fetch(&sequence_, 1, __ATOMIC_SEQ_CST) );
+    if( __atomic_load_n(&waiters_, __ATOMIC_SEQ_CST) > 0 )
+    {
+        static_cast<void>( Futex::wake(&sequence_, 1) );
+    }
+}
+
+int32_t QueueEvent::enter()
+{
+    static_cast<void>( __atomic_add_fetch(&waiters_, 1, __ATOMIC_SEQ_CST) );
+    return __atomic_load_n(&sequence_, __ATOMIC_SEQ_CST);
+}
+
+void QueueEvent::wait(int32_t const sequence)
+{
+    static_cast<void>( Futex::wait(&sequence_, sequence) );
+}
+
+void QueueEvent::leave()
+{
+    static_cast<void>( __atomic_sub_fetch(&waiters_, 1, __ATOMIC_RELAXED) );
+}
+
+} // namespace sys
+} // namespace eoos
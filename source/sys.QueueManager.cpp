@@ -0,0 +1,134 @@
+/**
+ * @file      sys.QueueManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.QueueManager.hpp"
+#include "lib.UniquePointer.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+api::Heap* QueueManager::resource_( NULLPTR );
+
+QueueManager::QueueManager() 
+    : NonCopyable<NoAllocator>()
+    , pool_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+QueueManager::~QueueManager()
+{
+    QueueManager::deinitialize();
+}
+
+bool_t QueueManager::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+SpscQueue<QueueManager, EOOS_GLOBAL_SYS_QUEUE_LENGTH>* QueueManager::createSpsc(bool_t const isBlocking)
+{
+    SpscResource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<SpscResource> res( new SpscResource(isBlocking) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }    
+    return ptr;
+}
+
+MpmcQueue<QueueManager, EOOS_GLOBAL_SYS_QUEUE_LENGTH>* QueueManager::createMpmc(bool_t const isBlocking)
+{
+    MpmcResource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<MpmcResource> res( new MpmcResource(isBlocking) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }    
+    return ptr;
+}
+
+bool_t QueueManager::getStatistics(ResourceStatistics& statistics) const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = pool_.memory.getStatistics(statistics);
+    }
+    return res;
+}
+
+bool_t QueueManager::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( pool_.memory.isConstructed() )
+        {
+            if( initialize(&pool_.memory) )
+            {
+                res = true;
+            }
+        }
+    }
+    return res;
+}
+
+void* QueueManager::allocate(size_t size)
+{
+    void* addr( NULLPTR );
+    if( resource_ != NULLPTR )
+    {
+        addr = resource_->allocate(size, NULLPTR);
+    }
+    return addr;
+}
+
+void QueueManager::free(void* ptr)
+{
+    if( resource_ != NULLPTR )
+    {
+        resource_->free(ptr);
+    }
+}
+
+bool_t QueueManager::initialize(api::Heap* resource)
+{
+    bool_t res( false );
+    if( resource_ == NULLPTR )
+    {
+        resource_ = resource;
+        res = true;
+    }
+    return res;
+}
+
+void QueueManager::deinitialize()
+{
+    resource_ = NULLPTR;
+}
+
+QueueManager::ResourcePool::ResourcePool()
+    : memory("EOOS_SYS_NUMBER_OF_QUEUES") {
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,293 @@
+/**
+ * @file      sys.Rcu.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.Rcu.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+Rcu::Rcu(api::Heap& heap)
+    : NonCopyable<NoAllocator>()
+    , heap_(heap)
+    , epoch_(1U)
+    , records_(NULLPTR)
+    , retired_()
+    , retiredCount_(0)
+    , isExpedited_(false)
+    , key_()
+    , mutex_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+Rcu::~Rcu()
+{
+    if( isConstructed() )
+    {
+        static_cast<void>( reclaim() );
+        deinitialize();
+    }
+}
+
+bool_t Rcu::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+bool_t Rcu::lock()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        Record* const record( getRecord() );
+        if( record != NULLPTR )
+        {
+            if( record->nesting == 0 )
+            {
+                uint32_t const epoch( __atomic_load_n(&epoch_, __ATOMIC_ACQUIRE) );
+                __atomic_store_n(&record->epoch, epoch, __ATOMIC_RELAXED);
+                // The record is published before the protected data are read
+                barrier();
+            }
+            ++record->nesting;
+            res = true;
+        }
+    }
+    return res;
+}
+
+void Rcu::unlock()
+{
+    if( isConstructed() )
+    {
+        Record* const record( static_cast<Record*>( ::pthread_getspecific(key_) ) );
+        if( (record != NULLPTR) && (record->nesting > 0) )
+        {
+            --record->nesting;
+            if( record->nesting == 0 )
+            {
+                __atomic_store_n(&record->epoch, 0U, __ATOMIC_RELEASE);
+            }
+        }
+    }
+}
+
+bool_t Rcu::synchronize()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            wait();
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool_t Rcu::retire(void* const ptr)
+{
+    bool_t res( false );
+    if( isConstructed() && (ptr != NULLPTR) )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            retired_[retiredCount_] = ptr;
+            ++retiredCount_;
+            if( retiredCount_ == RETIRE_LIMIT )
+            {
+                free();
+            }
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool_t Rcu::reclaim()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            free();
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool_t Rcu::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( ::pthread_mutex_init(&mutex_, NULLPTR) == 0 )
+        {
+            if( ::pthread_key_create(&key_, &release) == 0 )
+            {
+                isExpedited_ = isMembarrier();
+                res = true;
+            }
+            else
+            {
+                static_cast<void>( ::pthread_mutex_destroy(&mutex_) );
+            }
+        }
+    }
+    return res;
+}
+
+void Rcu::deinitialize()
+{
+    // The key is deleted first, so exiting threads do not release the records being freed
+    static_cast<void>( ::pthread_key_delete(key_) );
+    while( records_ != NULLPTR )
+    {
+        Record* const record( records_ );
+        records_ = record->next;
+        heap_.free(record);
+    }
+    static_cast<void>( ::pthread_mutex_destroy(&mutex_) );
+}
+
+Rcu::Record* Rcu::getRecord()
+{
+    Record* record( static_cast<Record*>( ::pthread_getspecific(key_) ) );
+    if( record == NULLPTR )
+    {
+        // A record released by an exited thread is reused
+        record = __atomic_load_n(&records_, __ATOMIC_ACQUIRE);
+        while( record != NULLPTR )
+        {
+            int32_t isUsed( 0 );
+            if( __atomic_compare_exchange_n(&record->isUsed, &isUsed, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) )
+            {
+                break;
+            }
+            record = record->next;
+        }
+        if( record == NULLPTR )
+        {
+            record = static_cast<Record*>( heap_.allocate(sizeof(Record), NULLPTR) );
+            if( record != NULLPTR )
+            {
+                record->epoch = 0U;
+                record->isUsed = 1;
+                record->next = __atomic_load_n(&records_, __ATOMIC_RELAXED);
+                while( !__atomic_compare_exchange_n(&records_, &record->next, record, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED) )
+                {
+                }
+            }
+        }
+        if( record != NULLPTR )
+        {
+            // The thread which used the record might have exited in a read-side critical section
+            __atomic_store_n(&record->epoch, 0U, __ATOMIC_RELAXED);
+            record->nesting = 0;
+            if( ::pthread_setspecific(key_, record) != 0 )
+            {
+                __atomic_store_n(&record->isUsed, 0, __ATOMIC_RELEASE);
+                record = NULLPTR;
+            }
+        }
+    }
+    return record;
+}
+
+void Rcu::wait()
+{
+    // The data published by the writer are ordered before the records are read
+    synchronizeCpus();
+    uint32_t epoch( epoch_ + 1U );
+    if( epoch == 0U )
+    {
+        epoch = 1U;
+    }
+    __atomic_store_n(&epoch_, epoch, __ATOMIC_RELEASE);
+    Record* record( __atomic_load_n(&records_, __ATOMIC_ACQUIRE) );
+    while( record != NULLPTR )
+    {
+        while( true )
+        {
+            uint32_t const entered( __atomic_load_n(&record->epoch, __ATOMIC_ACQUIRE) );
+            // A reader in a section entered in this epoch has seen the published data
+            if( (entered == 0U) || ( static_cast<int32_t>(entered - epoch) >= 0 ) )
+            {
+                break;
+            }
+            static_cast<void>( ::sched_yield() );
+        }
+        record = record->next;
+    }
+}
+
+void Rcu::free()
+{
+    wait();
+    for(int32_t i(0); i < retiredCount_; ++i)
+    {
+        heap_.free(retired_[i]);
+        retired_[i] = NULLPTR;
+    }
+    retiredCount_ = 0;
+}
+
+void Rcu::barrier() const
+{
+    if( isExpedited_ )
+    {
+        __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    }
+    else
+    {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+}
+
+void Rcu::synchronizeCpus() const
+{
+    if( isExpedited_ )
+    {
+        static_cast<void>( ::syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0) );
+    }
+    else
+    {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+}
+
+void Rcu::release(void* const record)
+{
+    if( record != NULLPTR )
+    {
+        // A thread exited in a read-side critical section does not stall grace periods
+        __atomic_store_n(&static_cast<Record*>(record)->epoch, 0U, __ATOMIC_RELAXED);
+        __atomic_store_n(&static_cast<Record*>(record)->isUsed, 0, __ATOMIC_RELEASE);
+    }
+}
+
+bool_t Rcu::isMembarrier()
+{
+    bool_t res( false );
+    long error( ::syscall(SYS_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0) ); ///< SCA MISRA-C++:2008 Justified Rule 3-9-2
+    if( error == 0 )
+    {
+        // Some kernels accept the registration but do not execute the command
+        error = ::syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0);
+        res = error == 0;
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
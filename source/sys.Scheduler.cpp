@@ -4,6 +4,7 @@
  * @copyright 2017-2023, Sergey Baigudin, Baigudin Software
  */
 #include "sys.Scheduler.hpp"
+#include "sys.Clock.hpp"
 #include "lib.UniquePointer.hpp"
 
 namespace eoos
@@ -16,7 +17,8 @@ api::Heap* Scheduler::resource_( NULLPTR );
 Scheduler::Scheduler()
     : NonCopyable<NoAllocator>()
     , api::Scheduler()
-    , pool_() {
+    , pool_()
+    , registry_() {
     bool_t const isConstructed( construct() );
     setConstructed( isConstructed );    
 }
@@ -36,19 +38,43 @@ api::Thread* Scheduler::createThread(api::Task& task)
     api::Thread* ptr( NULLPTR );
     if( isConstructed() )
     {
-        lib::UniquePointer<api::Thread> res( new Resource(task) );
-        if( !res.isNull() )
+        ptr = check( new Resource(task) );
+    }    
+    return ptr;
+}
+
+api::Thread* Scheduler::createThread(Storage& storage, api::Task& task)
+{
+    api::Thread* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        Resource* const res( new (storage.memory) Resource(task) );
+        if( res->isConstructed() && res->setRegistry(registry_) )
         {
-            if( !res->isConstructed() )
-            {
-                res.reset();
-            }
+            ptr = res;
         }
-        ptr = res.release();
-    }    
+        else
+        {
+            res->~Resource();
+        }
+    }
     return ptr;
 }
 
+api::Thread* Scheduler::createThread(void (*function)(), size_t const stackSize)
+{
+    // The function is passed as a pointer, as a function type cannot be copied into the thread resource
+    return createThread< void(*)() >(function, stackSize);
+}
+
+void Scheduler::destroyThread(Storage& storage)
+{
+    Resource* const thread( static_cast<Resource*>( static_cast<void*>(storage.memory) ) );
+    static_cast<void>( thread->cancel() );
+    static_cast<void>( thread->join() );
+    thread->~Resource();
+}
+
 bool_t Scheduler::sleep(int32_t ms)
 {
     bool_t res( false );
@@ -76,12 +102,46 @@ bool_t Scheduler::yield()
     return res;
 }
 
+bool_t Scheduler::stop(int32_t const ms)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        ::timespec deadline;
+        if( Clock::getDeadline(ms, deadline) )
+        {
+            res = registry_.stop(deadline);
+        }
+    }
+    return res;
+}
+
+int32_t Scheduler::getThreadStatistics(ThreadStatistics* const statistics, int32_t const length)
+{
+    int32_t number( -1 );
+    if( isConstructed() )
+    {
+        number = registry_.getStatistics(statistics, length);
+    }
+    return number;
+}
+
+bool_t Scheduler::getStatistics(ResourceStatistics& statistics) const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = pool_.memory.getStatistics(statistics);
+    }
+    return res;
+}
+
 bool_t Scheduler::construct()
 {
     bool_t res( false );
     if( isConstructed() )
     {
-        if( pool_.memory.isConstructed() )
+        if( pool_.memory.isConstructed() && registry_.isConstructed() )
         {
             if( initialize(&pool_.memory) )
             {
@@ -98,6 +158,19 @@ bool_t Scheduler::construct()
     return res;
 }
 
+api::Thread* Scheduler::check(Resource* const resource)
+{
+    lib::UniquePointer<Resource> res( resource );
+    if( !res.isNull() )
+    {
+        if( !res->isConstructed() || !res->setRegistry(registry_) )
+        {
+            res.reset();
+        }
+    }
+    return res.release();
+}
+
 bool_t Scheduler::setThreadAffinity()
 {
     #ifdef EOOS_GLOBAL_SYS_SCHEDULER_THREAD_AFFINITY
@@ -212,8 +285,7 @@ void Scheduler::deinitialize()
 }
 
 Scheduler::ResourcePool::ResourcePool()
-    : mutex_()
-    , memory( mutex_ ) {
+    : memory("EOOS_SYS_NUMBER_OF_THREADS") {
 }
 
 } // namespace sys
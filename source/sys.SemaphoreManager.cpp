@@ -31,12 +31,12 @@ bool_t SemaphoreManager::isConstructed() const
     return Parent::isConstructed();
 }
 
-api::Semaphore* SemaphoreManager::create(int32_t permits)
+SemaphoreManager::Resource* SemaphoreManager::create(int32_t permits)
 {
-    api::Semaphore* ptr( NULLPTR );
+    Resource* ptr( NULLPTR );
     if( isConstructed() )
     {
-        lib::UniquePointer<api::Semaphore> res( new Resource(permits) );
+        lib::UniquePointer<Resource> res( new Resource(permits) );
         if( !res.isNull() )
         {
             if( !res->isConstructed() )
@@ -49,15 +49,254 @@ api::Semaphore* SemaphoreManager::create(int32_t permits)
     return ptr;
 }
 
+api::Semaphore* SemaphoreManager::create(int32_t const permits, Type const type)
+{
+    api::Semaphore* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        api::Semaphore* semaphore( NULLPTR );
+        switch( type )
+        {
+            case TYPE_POSIX:
+            {
+                semaphore = new Resource(permits);
+                break;
+            }
+            case TYPE_FUTEX:
+            {
+                semaphore = new FutexResource(permits);
+                break;
+            }
+            case TYPE_FAIR:
+            {
+                semaphore = new FairResource(permits);
+                break;
+            }
+            case TYPE_EVENT:
+            {
+                semaphore = new EventResource(permits);
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+        lib::UniquePointer<api::Semaphore> res( semaphore );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+SemaphoreManager::FutexResource* SemaphoreManager::createFutex(int32_t const permits)
+{
+    FutexResource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<FutexResource> res( new FutexResource(permits) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+SemaphoreManager::FairResource* SemaphoreManager::createFair(int32_t const permits)
+{
+    FairResource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<FairResource> res( new FairResource(permits) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+SemaphoreManager::Resource* SemaphoreManager::create(Storage& storage, int32_t const permits)
+{
+    Resource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        Resource* const res( new (storage.memory) Resource(permits) );
+        if( res->isConstructed() )
+        {
+            ptr = res;
+        }
+        else
+        {
+            res->~Resource();
+        }
+    }
+    return ptr;
+}
+
+void SemaphoreManager::destroy(Storage& storage)
+{
+    void* const memory( storage.memory );
+    static_cast<Resource*>(memory)->~Resource();
+}
+
+SemaphoreManager::Array* SemaphoreManager::createArray(int32_t const length, int32_t const permits)
+{
+    Array* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<Array> res( Array::create(length, permits) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+SemaphoreManager::EventResource* SemaphoreManager::createEvent(int32_t const permits)
+{
+    EventResource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<EventResource> res( new EventResource(permits) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+SemaphoreManager::SharedResource* SemaphoreManager::createShared(char_t const* const name, int32_t const permits)
+{
+    SharedResource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<SharedResource> res( new SharedResource(name, permits) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+bool_t SemaphoreManager::removeShared(char_t const* const name)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = SharedMemory::remove(name);
+    }
+    return res;
+}
+
+SemaphoreManager::NamedResource* SemaphoreManager::createNamed(char_t const* const name, int32_t const permits)
+{
+    NamedResource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<NamedResource> res( new NamedResource(name, permits) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+bool_t SemaphoreManager::removeNamed(char_t const* const name)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = NamedResource::remove(name);
+    }
+    return res;
+}
+
+bool_t SemaphoreManager::getStatistics(ResourceStatistics& statistics) const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        ResourceStatistics pools[NUMBER_OF_POOLS];
+        res = pool_.posix.getStatistics(pools[POOL_POSIX])
+           && pool_.shared.getStatistics(pools[POOL_SHARED])
+           && pool_.event.getStatistics(pools[POOL_EVENT])
+           && pool_.named.getStatistics(pools[POOL_NAMED])
+           && pool_.futex.getStatistics(pools[POOL_FUTEX])
+           && pool_.fair.getStatistics(pools[POOL_FAIR]);
+        if( res )
+        {
+            statistics.capacity = 0;
+            statistics.committed = 0;
+            statistics.used = 0;
+            statistics.fallbacks = 0;
+            for(int32_t i(0); i < NUMBER_OF_POOLS; ++i)
+            {
+                statistics.capacity += pools[i].capacity;
+                statistics.committed += pools[i].committed;
+                statistics.used += pools[i].used;
+                statistics.fallbacks += pools[i].fallbacks;
+            }
+        }
+    }
+    return res;
+}
+
 bool_t SemaphoreManager::construct()
 {
     bool_t res( false );
     if( isConstructed() )
     {
-        if( pool_.memory.isConstructed() )
+        if( pool_.posix.isConstructed()
+         && pool_.shared.isConstructed()
+         && pool_.event.isConstructed()
+         && pool_.named.isConstructed()
+         && pool_.futex.isConstructed()
+         && pool_.fair.isConstructed() )
         {
-            if( initialize(&pool_.memory) )
+            if( initialize(&pool_.posix) )
             {
+                Allocator<POOL_POSIX>::resource_ = &pool_.posix;
+                Allocator<POOL_SHARED>::resource_ = &pool_.shared;
+                Allocator<POOL_EVENT>::resource_ = &pool_.event;
+                Allocator<POOL_NAMED>::resource_ = &pool_.named;
+                Allocator<POOL_FUTEX>::resource_ = &pool_.futex;
+                Allocator<POOL_FAIR>::resource_ = &pool_.fair;
                 res = true;
             }
         }
@@ -97,11 +336,21 @@ bool_t SemaphoreManager::initialize(api::Heap* resource)
 void SemaphoreManager::deinitialize()
 {
     resource_ = NULLPTR;
+    Allocator<POOL_POSIX>::resource_ = NULLPTR;
+    Allocator<POOL_SHARED>::resource_ = NULLPTR;
+    Allocator<POOL_EVENT>::resource_ = NULLPTR;
+    Allocator<POOL_NAMED>::resource_ = NULLPTR;
+    Allocator<POOL_FUTEX>::resource_ = NULLPTR;
+    Allocator<POOL_FAIR>::resource_ = NULLPTR;
 }
 
 SemaphoreManager::ResourcePool::ResourcePool()
-    : mutex_()
-    , memory( mutex_ ) {
+    : posix("EOOS_SYS_NUMBER_OF_SEMAPHORES")
+    , shared("EOOS_SYS_NUMBER_OF_SEMAPHORES")
+    , event("EOOS_SYS_NUMBER_OF_SEMAPHORES")
+    , named("EOOS_SYS_NUMBER_OF_SEMAPHORES")
+    , futex("EOOS_SYS_NUMBER_OF_SEMAPHORES")
+    , fair("EOOS_SYS_NUMBER_OF_SEMAPHORES") {
 }
 
 } // namespace sys
@@ -0,0 +1,149 @@
+/**
+ * @file      sys.SharedMemory.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.SharedMemory.hpp"
+#include "sys.Clock.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+SharedMemory::SharedMemory(char_t const* const name, size_t const size)
+    : NonCopyable<NoAllocator>()
+    , size_( HEADER_SIZE + size )
+    , addr_( NULLPTR ) {
+    bool_t const isConstructed( construct(name) );
+    setConstructed( isConstructed );
+}
+
+SharedMemory::~SharedMemory()
+{
+    if( addr_ != NULLPTR )
+    {
+        static_cast<void>( ::munmap(addr_, size_) );
+    }
+}
+
+bool_t SharedMemory::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+void* SharedMemory::getAddress() const
+{
+    void* addr( NULLPTR );
+    if( isConstructed() )
+    {
+        addr = &static_cast<uint8_t*>(addr_)[HEADER_SIZE];
+    }
+    return addr;
+}
+
+SharedMemory::Initialization SharedMemory::beginInitialization()
+{
+    Initialization res( INITIALIZATION_FAILED );
+    ::timespec deadline;
+    if( isConstructed() && Clock::getDeadline(EOOS_GLOBAL_SYS_SHARED_MEMORY_TIMEOUT, deadline) )
+    {
+        int32_t* const state( getState() );
+        int32_t const pid( static_cast<int32_t>( ::getpid() ) );
+        int32_t expected( STATE_NEW );
+        while( true )
+        {
+            if( expected == STATE_READY )
+            {
+                res = INITIALIZATION_DONE;
+                break;
+            }
+            // The content is new, or the process initializing it has terminated, so the caller initializes it
+            if( ( (expected == STATE_NEW) || isTerminated(expected) )
+             && ( __atomic_compare_exchange_n(state, &expected, pid, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE) ) )
+            {
+                res = INITIALIZATION_REQUIRED;
+                break;
+            }
+            if( expected == __atomic_load_n(state, __ATOMIC_ACQUIRE) )
+            {
+                if( Clock::isExpired(deadline) )
+                {
+                    break;
+                }
+                static_cast<void>( ::usleep(1000U) );
+            }
+            expected = __atomic_load_n(state, __ATOMIC_ACQUIRE);
+        }
+    }
+    return res;
+}
+
+void SharedMemory::endInitialization(bool_t const isInitialized)
+{
+    if( isConstructed() )
+    {
+        int32_t const state( isInitialized ? STATE_READY : STATE_NEW );
+        __atomic_store_n(getState(), state, __ATOMIC_RELEASE);
+    }
+}
+
+bool_t SharedMemory::remove(char_t const* const name)
+{
+    bool_t res( false );
+    if( name != NULLPTR )
+    {
+        int_t const error( ::shm_unlink(name) );
+        res = error == 0;
+    }
+    return res;
+}
+
+bool_t SharedMemory::construct(char_t const* const name)
+{
+    bool_t res( false );
+    if( isConstructed() && (name != NULLPTR) )
+    {
+        int_t const fd( ::shm_open(name, O_CREAT | O_RDWR, S_IRUSR | S_IWUSR) );
+        if( fd != -1 )
+        {
+            // New memory is filled with zeros, which makes the header state new
+            struct ::stat status;
+            int_t error( ::fstat(fd, &status) );
+            if( (error == 0) && (static_cast<size_t>(status.st_size) < size_) )
+            {
+                error = ::ftruncate(fd, static_cast< ::off_t >(size_));
+            }
+            if( error == 0 )
+            {
+                void* const addr( ::mmap(NULL, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) );
+                if( addr != MAP_FAILED ) ///< SCA MISRA-C++:2008 Justified Rule 5-2-4
+                {
+                    addr_ = addr;
+                    res = true;
+                }
+            }
+            static_cast<void>( ::close(fd) );
+        }
+    }
+    return res;
+}
+
+int32_t* SharedMemory::getState() const
+{
+    return static_cast<int32_t*>(addr_);
+}
+
+bool_t SharedMemory::isTerminated(int32_t const pid)
+{
+    bool_t res( false );
+    if( pid > 0 )
+    {
+        int_t const error( ::kill(static_cast< ::pid_t >(pid), 0) );
+        res = (error == -1) && (errno == ESRCH);
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
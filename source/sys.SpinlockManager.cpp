@@ -0,0 +1,124 @@
+/**
+ * @file      sys.SpinlockManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.SpinlockManager.hpp"
+#include "lib.UniquePointer.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+api::Heap* SpinlockManager::resource_( NULLPTR );
+
+SpinlockManager::SpinlockManager(api::Scheduler& scheduler)
+    : NonCopyable<NoAllocator>()
+    , api::MutexManager()
+    , scheduler_(scheduler)
+    , pool_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+SpinlockManager::~SpinlockManager()
+{
+    SpinlockManager::deinitialize();
+}
+
+bool_t SpinlockManager::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+api::Mutex* SpinlockManager::create()
+{
+    return create(true);
+}
+
+Spinlock<SpinlockManager>* SpinlockManager::create(bool_t const isYielding)
+{
+    Resource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        api::Scheduler* const scheduler( isYielding ? &scheduler_ : NULLPTR );
+        lib::UniquePointer<Resource> res( new Resource(scheduler) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }    
+    return ptr;
+}
+
+bool_t SpinlockManager::getStatistics(ResourceStatistics& statistics) const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = pool_.memory.getStatistics(statistics);
+    }
+    return res;
+}
+
+bool_t SpinlockManager::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( pool_.memory.isConstructed() )
+        {
+            if( initialize(&pool_.memory) )
+            {
+                res = true;
+            }
+        }
+    }
+    return res;
+}
+
+void* SpinlockManager::allocate(size_t size)
+{
+    void* addr( NULLPTR );
+    if( resource_ != NULLPTR )
+    {
+        addr = resource_->allocate(size, NULLPTR);
+    }
+    return addr;
+}
+
+void SpinlockManager::free(void* ptr)
+{
+    if( resource_ != NULLPTR )
+    {
+        resource_->free(ptr);
+    }
+}
+
+bool_t SpinlockManager::initialize(api::Heap* resource)
+{
+    bool_t res( false );
+    if( resource_ == NULLPTR )
+    {
+        resource_ = resource;
+        res = true;
+    }
+    return res;
+}
+
+void SpinlockManager::deinitialize()
+{
+    resource_ = NULLPTR;
+}
+
+SpinlockManager::ResourcePool::ResourcePool()
+    : memory("EOOS_SYS_NUMBER_OF_SPINLOCKS") {
+}
+
+} // namespace sys
+} // namespace eoos
@@ -33,12 +33,12 @@ bool_t StreamManager::isConstructed() const
 
 api::OutStream<char_t>& StreamManager::getCout()
 {
-    return *cout_;
+    return *__atomic_load_n(&cout_, __ATOMIC_ACQUIRE);
 }
 
 api::OutStream<char_t>& StreamManager::getCerr()
 {
-    return *cerr_;
+    return *__atomic_load_n(&cerr_, __ATOMIC_ACQUIRE);
 }
 
 bool_t StreamManager::setCout(api::OutStream<char_t>& cout)
@@ -46,7 +46,7 @@ bool_t StreamManager::setCout(api::OutStream<char_t>& cout)
     bool_t res( false );
     if( isConstructed() )
     {
-        cout_ = &cout;
+        set(&cout_, &cout);
         res = true;
     }
     return res;
@@ -57,7 +57,7 @@ bool_t StreamManager::setCerr(api::OutStream<char_t>& cerr)
     bool_t res( false );
     if( isConstructed() )
     {
-        cerr_ = &cerr;
+        set(&cerr_, &cerr);
         res = true;
     }
     return res;
@@ -65,12 +65,17 @@ bool_t StreamManager::setCerr(api::OutStream<char_t>& cerr)
 
 void StreamManager::resetCout()
 {
-    cout_ = &coutDef_;
+    set(&cout_, &coutDef_);
 }
 
 void StreamManager::resetCerr()
 {
-    cerr_ = &cerrDef_;
+    set(&cerr_, &cerrDef_);
+}
+
+void StreamManager::set(api::OutStream<char_t>** const stream, api::OutStream<char_t>* const value)
+{
+    __atomic_store_n(stream, value, __ATOMIC_RELEASE);
 }
     
 } // namespace sys
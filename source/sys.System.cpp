@@ -17,16 +17,36 @@ System::System()
     : NonCopyable<NoAllocator>()
     , api::System()
     , heap_()
+    , rcu_(NULLPTR)
     , scheduler_()
     , mutexManager_()
     , semaphoreManager_()    
-    , streamManager_() {
+    , streamManager_()
+    , conditionVariableManager_()
+    , spinlockManager_(scheduler_)
+    , barrierManager_()
+    , eventFlagsManager_()
+    , queueManager_() {
     bool_t const isConstructed( construct() );
     setConstructed( isConstructed );
 }    
 
 System::~System()
 {
+    if( isConstructed() )
+    {
+        // Threads still running are stopped before the system resources they might use are destroyed,
+        // and the threads which have not returned on the cancellation request in time are left detached
+        if( !scheduler_.stop(EOOS_GLOBAL_SYS_THREAD_STOP_TIMEOUT) )
+        {
+            reportThreads();
+        }
+        if( rcu_ != NULLPTR )
+        {
+            rcu_->~Rcu();
+            heap_.free(rcu_);
+        }
+    }
     eoos_ = NULLPTR;
 }
 
@@ -60,6 +80,66 @@ api::StreamManager& System::getStreamManager()
     return streamManager_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
 }
 
+ConditionVariableManager& System::getConditionVariableManager()
+{
+    return conditionVariableManager_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
+}
+
+SpinlockManager& System::getSpinlockManager()
+{
+    return spinlockManager_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
+}
+
+BarrierManager& System::getBarrierManager()
+{
+    return barrierManager_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
+}
+
+EventFlagsManager& System::getEventFlagsManager()
+{
+    return eventFlagsManager_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
+}
+
+QueueManager& System::getQueueManager()
+{
+    return queueManager_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
+}
+
+Rcu* System::getRcu()
+{
+    Rcu* rcu( __atomic_load_n(&rcu_, __ATOMIC_ACQUIRE) );
+    if( (rcu == NULLPTR) && isConstructed() )
+    {
+        void* const memory( heap_.allocate(sizeof(Rcu), NULLPTR) );
+        if( memory != NULLPTR )
+        {
+            Rcu* const created( new (memory) Rcu(heap_) );
+            // The RCU created by a thread which loses the race is deleted
+            if( created->isConstructed()
+             && __atomic_compare_exchange_n(&rcu_, &rcu, created, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) )
+            {
+                rcu = created;
+            }
+            else
+            {
+                created->~Rcu();
+                heap_.free(memory);
+            }
+        }
+    }
+    return rcu;
+}
+
+int32_t System::getThreadStatistics(ThreadStatistics* const statistics, int32_t const length)
+{
+    int32_t number( -1 );
+    if( isConstructed() )
+    {
+        number = scheduler_.getThreadStatistics(statistics, length);
+    }
+    return number;
+}
+
 int32_t System::execute(int32_t argc, char_t* argv[]) const
 {
     return Program::start(argc, argv);
@@ -74,6 +154,28 @@ System& System::getSystem()
     return *eoos_;
 }
 
+void System::reportThreads()
+{
+    ThreadStatistics statistics[REPORT_LENGTH];
+    int32_t const number( scheduler_.getThreadStatistics(statistics, REPORT_LENGTH) );
+    int32_t const copied( (number < REPORT_LENGTH) ? number : REPORT_LENGTH );
+    api::OutStream<char_t>& cerr( streamManager_.getCerr() );
+    cerr << "EOOS: Threads have not returned on stop and are left detached:";
+    for(int32_t i(0); i < copied; ++i)
+    {
+        if( statistics[i].status == api::Thread::STATUS_RUNNABLE )
+        {
+            cerr << " " << statistics[i].name << "[" << statistics[i].tid << "]";
+        }
+    }
+    if( number > REPORT_LENGTH )
+    {
+        cerr << " ...";
+    }
+    cerr << "\n";
+    static_cast<void>( cerr.flush() );
+}
+
 bool_t System::construct()
 {
     bool_t res( false );
@@ -83,7 +185,12 @@ bool_t System::construct()
      && ( scheduler_.isConstructed() )
      && ( mutexManager_.isConstructed() )
      && ( semaphoreManager_.isConstructed() )
-     && ( streamManager_.isConstructed() ) ) 
+     && ( streamManager_.isConstructed() )
+     && ( conditionVariableManager_.isConstructed() )
+     && ( spinlockManager_.isConstructed() )
+     && ( barrierManager_.isConstructed() )
+     && ( eventFlagsManager_.isConstructed() )
+     && ( queueManager_.isConstructed() ) ) 
     {
         eoos_ = this;
         res = true;
@@ -0,0 +1,410 @@
+/**
+ * @file      sys.ThreadRegistry.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.ThreadRegistry.hpp"
+#include "sys.Futex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+::pthread_mutex_t ThreadRegistry::exit_ = PTHREAD_MUTEX_INITIALIZER;
+
+ThreadRegistry::ThreadRegistry()
+    : NonCopyable<NoAllocator>()
+    , mutex_()
+    , head_(NULLPTR)
+    , running_(0) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+ThreadRegistry::~ThreadRegistry()
+{
+    if( isConstructed() )
+    {
+        // The routines of threads which have not returned do not access this registry anymore
+        if( lock() )
+        {
+            Node* node( head_ );
+            while( node != NULLPTR )
+            {
+                node->registry = NULLPTR;
+                node = node->next;
+            }
+            unlock();
+        }
+        static_cast<void>( ::pthread_mutex_destroy(&mutex_) );
+    }
+}
+
+bool_t ThreadRegistry::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+bool_t ThreadRegistry::add(Node& node)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            node.prev = NULLPTR;
+            node.next = head_;
+            node.registry = this;
+            node.status = api::Thread::STATUS_NEW;
+            node.isRemoved = false;
+            if( head_ != NULLPTR )
+            {
+                head_->prev = &node;
+            }
+            head_ = &node;
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool_t ThreadRegistry::remove(Node* const node)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            Node* const current( find(node) );
+            if( current != NULLPTR )
+            {
+                if( current->status == api::Thread::STATUS_RUNNABLE )
+                {
+                    current->isRemoved = true;
+                }
+                else
+                {
+                    unlink(current);
+                }
+                res = true;
+            }
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+        }
+    }
+    return res;
+}
+
+bool_t ThreadRegistry::start(Node* const node)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            Node* const current( find(node) );
+            if( (current != NULLPTR) && (current->status == api::Thread::STATUS_NEW) )
+            {
+                current->status = api::Thread::STATUS_RUNNABLE;
+                static_cast<void>( __atomic_add_fetch(&running_, 1, __ATOMIC_SEQ_CST) );
+                res = true;
+            }
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+        }
+    }
+    return res;
+}
+
+bool_t ThreadRegistry::finish(Node* const node)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            if( node->status == api::Thread::STATUS_RUNNABLE )
+            {
+                node->status = api::Thread::STATUS_DEAD;
+                if( node->isRemoved )
+                {
+                    unlink(node);
+                }
+                res = true;
+            }
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+        }
+    }
+    return res;
+}
+
+void ThreadRegistry::leave()
+{
+    if( __atomic_sub_fetch(&running_, 1, __ATOMIC_SEQ_CST) == 0 )
+    {
+        static_cast<void>( Futex::wake(&running_, INT_MAX) );
+    }
+}
+
+bool_t ThreadRegistry::setName(Node& node, char_t const* const name)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            copyName(node, name);
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool_t ThreadRegistry::stop(::timespec const& deadline)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            Node* node( head_ );
+            while( node != NULLPTR )
+            {
+                if( node->status == api::Thread::STATUS_RUNNABLE )
+                {
+                    node->token->cancel();
+                }
+                node = node->next;
+            }
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+            while( true )
+            {
+                int32_t const running( __atomic_load_n(&running_, __ATOMIC_SEQ_CST) );
+                if( running == 0 )
+                {
+                    res = true;
+                    break;
+                }
+                if( !Futex::wait(&running_, running, deadline) )
+                {
+                    res = __atomic_load_n(&running_, __ATOMIC_SEQ_CST) == 0;
+                    break;
+                }
+            }
+        }
+    }
+    return res;
+}
+
+int32_t ThreadRegistry::getStatistics(ThreadStatistics* const statistics, int32_t const length)
+{
+    int32_t number( -1 );
+    if( isConstructed() && ( (statistics != NULLPTR) || (length == 0) ) )
+    {
+        if( ::pthread_mutex_lock(&mutex_) == 0 )
+        {
+            number = 0;
+            Node const* node( head_ );
+            while( node != NULLPTR )
+            {
+                if( number < length )
+                {
+                    copy(*node, statistics[number]);
+                }
+                ++number;
+                node = node->next;
+            }
+            static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+            // The OS is asked after the list is unlocked, so threads are not held up on creation and return
+            int32_t const copied( (number < length) ? number : length );
+            for(int32_t i(0); i < copied; ++i)
+            {
+                collect(statistics[i]);
+            }
+        }
+    }
+    return number;
+}
+
+bool_t ThreadRegistry::lock()
+{
+    return ::pthread_mutex_lock(&exit_) == 0;
+}
+
+void ThreadRegistry::unlock()
+{
+    static_cast<void>( ::pthread_mutex_unlock(&exit_) );
+}
+
+void ThreadRegistry::copyName(Node& node, char_t const* const name)
+{
+    int32_t i( 0 );
+    if( name != NULLPTR )
+    {
+        while( (i < (ThreadStatistics::NAME_LENGTH - 1)) && (name[i] != '\0') )
+        {
+            node.name[i] = name[i];
+            ++i;
+        }
+    }
+    node.name[i] = '\0';
+}
+
+bool_t ThreadRegistry::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( ::pthread_mutex_init(&mutex_, NULLPTR) == 0 )
+        {
+            res = true;
+        }
+    }
+    return res;
+}
+
+void ThreadRegistry::unlink(Node* const node)
+{
+    if( node->prev != NULLPTR )
+    {
+        node->prev->next = node->next;
+    }
+    else
+    {
+        head_ = node->next;
+    }
+    if( node->next != NULLPTR )
+    {
+        node->next->prev = node->prev;
+    }
+}
+
+ThreadRegistry::Node* ThreadRegistry::find(Node const* const node) const
+{
+    Node* current( head_ );
+    while( (current != NULLPTR) && (current != node) )
+    {
+        current = current->next;
+    }
+    return current;
+}
+
+void ThreadRegistry::copy(Node const& node, ThreadStatistics& statistics)
+{
+    for(int32_t i(0); i < ThreadStatistics::NAME_LENGTH; ++i)
+    {
+        statistics.name[i] = node.name[i];
+    }
+    statistics.status = node.status;
+    statistics.priority = __atomic_load_n(&node.priority, __ATOMIC_RELAXED);
+    statistics.tid = -1;
+    statistics.affinity = 0U;
+    statistics.cpu = -1;
+    statistics.cpuTime = -1;
+    statistics.waitTime = -1;
+    statistics.voluntarySwitches = -1;
+    statistics.involuntarySwitches = -1;
+    statistics.migrations = -1;
+    int32_t const tid( __atomic_load_n(&node.tid, __ATOMIC_ACQUIRE) );
+    if( (node.status == api::Thread::STATUS_RUNNABLE) && (tid != 0) )
+    {
+        statistics.tid = tid;
+    }
+}
+
+void ThreadRegistry::collect(ThreadStatistics& statistics)
+{
+    int32_t const tid( statistics.tid );
+    if( tid != -1 )
+    {
+        // Only the kernel thread identifier is used, as the thread resource identifier
+        // of a thread which has exited and been joined is not valid anymore
+        ::cpu_set_t set;
+        if( ::sched_getaffinity(static_cast< ::pid_t >(tid), sizeof(set), &set) == 0 )
+        {
+            for(int32_t cpu(0); cpu < 64; ++cpu)
+            {
+                if( CPU_ISSET(cpu, &set) )
+                {
+                    statistics.affinity |= static_cast<uint64_t>(1) << cpu;
+                }
+            }
+        }
+        char_t buffer[4096];
+        // RUSAGE_THREAD reports the caller thread only, so the counters of other threads are read from the proc file system
+        if( readFile(tid, "status", buffer, sizeof(buffer)) )
+        {
+            statistics.voluntarySwitches = findNumber(buffer, "\nvoluntary_ctxt_switches");
+            statistics.involuntarySwitches = findNumber(buffer, "\nnonvoluntary_ctxt_switches");
+        }
+        if( readFile(tid, "sched", buffer, sizeof(buffer)) )
+        {
+            statistics.migrations = findNumber(buffer, "\nse.nr_migrations");
+        }
+        if( readFile(tid, "schedstat", buffer, sizeof(buffer)) )
+        {
+            // The fields are CPU time, run queue wait time and number of time slices
+            char_t* end( NULLPTR );
+            int64_t const time( static_cast<int64_t>( ::strtoll(buffer, &end, 10) ) );
+            if( end != buffer )
+            {
+                statistics.cpuTime = time;
+                statistics.waitTime = static_cast<int64_t>( ::strtoll(end, NULLPTR, 10) );
+            }
+        }
+        if( readFile(tid, "stat", buffer, sizeof(buffer)) )
+        {
+            // The CPU is the 39th field, and the fields from the 3rd one follow the last parenthesis of the command name
+            char_t const* field( ::strrchr(buffer, ')') );
+            for(int32_t i(2); (i < 39) && (field != NULLPTR); ++i)
+            {
+                field = ::strchr(&field[1], ' ');
+            }
+            if( field != NULLPTR )
+            {
+                statistics.cpu = static_cast<int32_t>( ::strtol(field, NULLPTR, 10) );
+            }
+        }
+    }
+}
+
+bool_t ThreadRegistry::readFile(int32_t const tid, char_t const* const file, char_t* const buffer, size_t const size)
+{
+    bool_t res( false );
+    char_t path[64];
+    int_t const length( ::snprintf(path, sizeof(path), "/proc/self/task/%d/%s", tid, file) );
+    if( (length > 0) && (static_cast<size_t>(length) < sizeof(path)) )
+    {
+        int_t const fd( ::open(path, O_RDONLY | O_CLOEXEC) );
+        if( fd >= 0 )
+        {
+            ::ssize_t const bytes( ::read(fd, buffer, size - 1U) );
+            if( bytes > 0 )
+            {
+                buffer[bytes] = '\0';
+                res = true;
+            }
+            static_cast<void>( ::close(fd) );
+        }
+    }
+    return res;
+}
+
+int64_t ThreadRegistry::findNumber(char_t const* const text, char_t const* const key)
+{
+    int64_t number( -1 );
+    char_t const* value( ::strstr(text, key) );
+    if( value != NULLPTR )
+    {
+        value = ::strchr(&value[1], ':');
+        if( value != NULLPTR )
+        {
+            number = static_cast<int64_t>( ::strtoll(&value[1], NULLPTR, 10) );
+        }
+    }
+    return number;
+}
+
+} // namespace sys
+} // namespace eoos